@@ -67,10 +67,14 @@ public:
   // **************************************************************************
   // Getter/Setter
   // **************************************************************************
-  int GetPrintBase() { return printBase; };
+  int GetPrintBase() const { return printBase; };
   int GetWidth() const { return width; };
   string GetName() const { return name; };
   bool IsAppendWidthInCaption() const { return appendWidthInCaption_; };
+  int GetDigitCount() const { return DigitCount(width, printBase); };
+
+  static int DigitCount(const int _width, const int _printBase);
+  static int DigitValue(const char _c);
 };
 
 #endif /* TVDECLARATION_H_ */
@@ -0,0 +1,144 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVDirectFileBuffer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief A Linux file writer for huge test vector files.
+ * @version 0.1
+ *
+ * This file provides a stream buffer for writing very large test vector files
+ * with predictable throughput and without evicting other processes' data from
+ * the page cache.
+ */
+
+#ifndef TVDIRECTFILEBUFFER_H_
+#define TVDIRECTFILEBUFFER_H_
+
+#include <string>
+#include <streambuf>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+/**
+ * @class TVDirectFileBuffer
+ * @author agent
+ * @date 18 October 2026
+ * @brief Stream buffer writing aligned blocks asynchronously to a file.
+ * @version 0.1
+ *
+ * The data is collected in a pool of page-aligned buffers. Full buffers are
+ * handed over to a writer thread which stores them using @c pwritev (all
+ * buffers queued in the meantime at once), so the generation of the next
+ * buffer overlaps with the disk I/O. The file can be
+ * preallocated (@c fallocate) using the expected file size, e.g., as estimated
+ * by TVGenerator::EstimateFileSize(). If the page cache should be bypassed,
+ * the file is opened using @c O_DIRECT, or, if the file system does not
+ * support it, the written ranges are dropped from the cache right away.
+ *
+ * @code
+ * TVDirectFileBuffer file(path, TVGenerator::EstimateFileSize(settings, n), true);
+ * ostream fileStream(&file);
+ * tvGenerator.Initialize(settings, fileStream);
+ * ...
+ * tvGenerator.Finalize();
+ * file.Close();
+ * @endcode
+ *
+ * Since @c O_DIRECT requires aligned offsets, flushing the stream writes the
+ * last partial block padded with zeros and rewrites it later on; the padding
+ * is truncated by Close().
+ */
+class TVDirectFileBuffer : public streambuf {
+
+private:
+	/**
+	 * @brief A block handed over to the writer thread.
+	 */
+	struct WriteRequest {
+		char * data;
+		size_t length;
+		long long offset;
+	};
+
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	string filePath_;
+	int fd_;
+	bool isDirect_;
+	bool dropCache_;
+	bool isClosed_;
+	int error_;
+	size_t blockSize_;
+	long long offset_;
+	vector<char *> buffers_;
+	vector<char *> freeBuffers_;
+	deque<WriteRequest> pending_;
+	size_t inFlight_;
+	bool stopWriter_;
+	mutex mutex_;
+	condition_variable cond_;
+	thread writer_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	void Init(const long long _expectedSize, const bool _bypassPageCache,
+			const int _blockCount);
+	void WriterLoop();
+	int WriteBlocks(const WriteRequest * _requests, const size_t _count);
+	bool Submit();
+	bool WaitForWriter();
+
+protected:
+	virtual int_type overflow(int_type _c);
+	virtual int sync();
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVDirectFileBuffer(const string & _filePath, const long long _expectedSize,
+			const bool _bypassPageCache);
+	TVDirectFileBuffer(const string & _filePath, const long long _expectedSize,
+			const bool _bypassPageCache, const size_t _blockSize,
+			const int _blockCount);
+	virtual ~TVDirectFileBuffer();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	bool IsDirect() const { return isDirect_; }
+	long long GetBytesWritten() const { return offset_ + (pptr() - pbase()); }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	void Close();
+};
+
+#endif /* TVDIRECTFILEBUFFER_H_ */
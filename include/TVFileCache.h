@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVFileCache.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief A cache for test vector files.
+ * @version 0.1
+ *
+ * This file provides a cache allowing to skip the generation of test vector
+ * files whose inputs did not change since they have been generated last.
+ */
+
+#ifndef TVFILECACHE_H_
+#define TVFILECACHE_H_
+
+#include <string>
+#include <stdint.h>
+
+#include "TVFileSettings.h"
+
+using namespace std;
+
+/**
+ * @class TVFileCache
+ * @author agent
+ * @date 18 October 2026
+ * @brief Content-addressed test vector file cache.
+ * @version 0.1
+ *
+ * Cache entries are keyed on the test vector file settings (incl. the signal
+ * declarations, but excluding the file path) and a fingerprint provided by the
+ * caller, which has to capture everything else the content depends on (e.g.,
+ * the random seed and the version of the software model):
+ *
+ * @code
+ * TVFileCache cache("/scratch/tvcache");
+ * const string fingerprint = "seed=42;model=1.3";
+ * if (!cache.Fetch(settings, fingerprint)) {
+ *   settings.enableReproducibleHeader(true);
+ *   settings.enableContentHash(true);
+ *   ... generate the file using a TVGenerator ...
+ *   cache.Store(settings, fingerprint, tvGenerator.GetContentHash());
+ * }
+ * @endcode
+ *
+ * Every entry consists of the file itself and a description file holding the
+ * full (unhashed) key and the content hash, so hash collisions of the key are
+ * detected on lookup and damaged entries are not served. Files are copied
+ * into and out of the cache per default. Hard links are faster, but a file
+ * linked to a cache entry shares its data with it, hence, it must not be
+ * modified in place afterwards. Fetch() removes the file at the target path
+ * in any case, so generating the file after a miss is safe.
+ */
+class TVFileCache {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	string directory_;
+	bool useHardLinks_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	string GetEntryPath(const string & _key) const;
+	string GetDescriptionPath(const string & _key) const;
+	static string Describe(const TVFileSettings & _fileSettings,
+			const string & _fingerprint);
+	static string ReadDescription(const string & _descriptionPath,
+			uint64_t & _contentHash);
+	static bool HashFile(const string & _filePath, uint64_t & _contentHash);
+	bool LinkOrCopy(const string & _sourcePath, const string & _targetPath,
+			uint64_t * _contentHash) const;
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVFileCache(const string & _directory);
+	virtual ~TVFileCache();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	void SetUseHardLinks(const bool _useHardLinks) { useHardLinks_ = _useHardLinks; }
+	bool IsUseHardLinks() const { return useHardLinks_; }
+	string GetDirectory() const { return directory_; }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	static string ComputeKey(const TVFileSettings & _fileSettings,
+			const string & _fingerprint);
+
+	bool Fetch(const TVFileSettings & _fileSettings, const string & _fingerprint) const;
+	void Store(const TVFileSettings & _fileSettings, const string & _fingerprint,
+			const uint64_t _contentHash) const;
+};
+
+#endif /* TVFILECACHE_H_ */
@@ -65,6 +65,13 @@ private:
   string commentsColumnHeader_;	// The string indicating a comment at the end of a line.
   int signalCaptionInterval_;   // The interval after which the signal caption header is printed again.
   char dontCareIdentifier_;			// The character to be used in order to identify don't care values.
+  bool enableReproducibleHeader_; // Omit the run-specific entries (file path, creation time) in the header.
+  bool enableContentHash_;      // Enable/Disable hashing the file content while it is written.
+  bool enableToggleCoverage_;   // Enable/Disable collecting the toggle coverage of the signals.
+  bool enableDontCareCoverage_; // Enable/Disable counting the don't care values of the signals.
+  string timeColumnName_;       // Name of the time column in front of the signals (empty if disabled).
+  int timeColumnDigits_;        // Minimum number of (decimal) digits of the time column.
+  bool enableDeltaTime_;        // Write the time relative to the previous test vector instead of absolute.
 
   vector<SignalDeclaration> tvDeclarations_;
 
@@ -78,8 +85,13 @@ public:
   TVFileSettings(string _filePath, string _author, string _content,
       string _projectName, const string _commentIndicator,
       const string _columnIndicator, const int _commentSpaces);
+  TVFileSettings(const TVFileSettings & _other) = default;
+  TVFileSettings(TVFileSettings && _other) = default;
   virtual ~TVFileSettings();
 
+  TVFileSettings & operator=(const TVFileSettings & _other) = default;
+  TVFileSettings & operator=(TVFileSettings && _other) = default;
+
   // **************************************************************************
   // Getter/Setter
   // **************************************************************************
@@ -91,6 +103,18 @@ public:
     enableLineEndComments_ = _enableLineEndComments; };
   void enablePreLineComments(const bool _enablePreLineComments) {
     enablePreLineComments_ = _enablePreLineComments; };
+  void enableReproducibleHeader(const bool _enableReproducibleHeader) {
+    enableReproducibleHeader_ = _enableReproducibleHeader; };
+  void enableContentHash(const bool _enableContentHash) {
+    enableContentHash_ = _enableContentHash; };
+  void enableToggleCoverage(const bool _enableToggleCoverage) {
+    enableToggleCoverage_ = _enableToggleCoverage; };
+  void enableDontCareCoverage(const bool _enableDontCareCoverage) {
+    enableDontCareCoverage_ = _enableDontCareCoverage; };
+  void setTimeColumn(const string _name, const int _digits,
+      const bool _enableDeltaTime) {
+    timeColumnName_ = _name; timeColumnDigits_ = _digits;
+    enableDeltaTime_ = _enableDeltaTime; };
   void setTVDeclarations(const vector<SignalDeclaration> & _tvDeclarations) {
     tvDeclarations_ = _tvDeclarations; };
   string getFilePath() const { return filePath_; };
@@ -106,8 +130,16 @@ public:
   string getCommentsColumnHeader() const { return commentsColumnHeader_; };
   int getSignalCaptionInterval() const { return signalCaptionInterval_; };
   char getDontCareIdentifier() const { return dontCareIdentifier_; };
+  bool isEnableReproducibleHeader() const { return enableReproducibleHeader_; };
+  bool isEnableContentHash() const { return enableContentHash_; };
+  bool isEnableToggleCoverage() const { return enableToggleCoverage_; };
+  bool isEnableDontCareCoverage() const { return enableDontCareCoverage_; };
+  bool isEnableTimeColumn() const { return !timeColumnName_.empty(); };
+  string getTimeColumnName() const { return timeColumnName_; };
+  int getTimeColumnDigits() const { return timeColumnDigits_; };
+  bool isEnableDeltaTime() const { return enableDeltaTime_; };
 
-  vector<SignalDeclaration> getTVDeclarations() const { return tvDeclarations_; };
+  const vector<SignalDeclaration> & getTVDeclarations() const { return tvDeclarations_; };
 
 
   // **************************************************************************
@@ -0,0 +1,144 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVFileSplitter.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief Splits test vector files into shards and merges them again.
+ * @version 0.1
+ *
+ * This file provides a class for cutting large test vector files into smaller
+ * ones (e.g., to distribute them among several simulators) and for
+ * concatenating files generated by parallel runs, while keeping the file
+ * header and the signal captions intact.
+ */
+
+#ifndef TVFILESPLITTER_H_
+#define TVFILESPLITTER_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "TVFileSettings.h"
+
+using namespace std;
+
+class TVGenerator;
+
+/**
+ * @class TVFileSplitter
+ * @author agent
+ * @date 18 October 2026
+ * @brief Test vector file splitter and merger.
+ * @version 0.1
+ *
+ * The settings describe both the files read (comment indicator) and the files
+ * written (file header entries, signal captions and their interval). The
+ * files are memory mapped. All lines starting with the comment indicator (file
+ * header, signal captions, comment lines) are dropped, every other non-empty
+ * line is a test vector line and is copied unchanged (incl. its line-end
+ * comment). Every file written gets a single new header and its signal
+ * captions at the configured interval, i.e., its test vector count starts
+ * from zero.
+ *
+ * If the settings enable the time column, the time of every test vector line
+ * is re-encoded for the file written: with delta encoding, the first test
+ * vector of a shard gets its absolute time (summing up the deltas preceding
+ * it) and the first test vector of every merged file is written as a delta
+ * to the last test vector of the previous file.
+ *
+ * Splitting scans the input on multiple threads, each of them starting at a
+ * line boundary, and writes the shards in parallel.
+ */
+class TVFileSplitter {
+
+private:
+	/**
+	 * @brief A read-only memory mapping of a whole file.
+	 */
+	class MappedFile {
+	public:
+		const char * data;
+		size_t size;
+		MappedFile(const string & _filePath);
+		~MappedFile();
+	private:
+		MappedFile(const MappedFile &);
+		MappedFile & operator=(const MappedFile &);
+	};
+
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	TVFileSettings fileSettings_;
+	int threadCount_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	bool IsVectorLine(const char * _begin, const char * _end) const;
+	vector<size_t> GetPieces(const MappedFile & _file) const;
+	long long CountVectorLines(const MappedFile & _file, const size_t _begin,
+			const size_t _end) const;
+	void FindCuts(const MappedFile & _file, const size_t _begin, const size_t _end,
+			long long _firstIndex, const long long _vectorsPerShard,
+			vector<size_t> & _cuts) const;
+	size_t FindVectorLine(const MappedFile & _file, size_t _pos) const;
+	const char * ParseTime(const char * _begin, const char * _end,
+			long long & _time) const;
+	long long SumTimes(const MappedFile & _file, const size_t _begin,
+			const size_t _end) const;
+	void RunOnShards(const size_t _shardCount,
+			const function<void(size_t)> & _task) const;
+	vector<string> WriteShards(const MappedFile & _file, const vector<size_t> & _cuts,
+			const string & _outputPrefix) const;
+	long long CopyVectorLines(const MappedFile & _file, const size_t _begin,
+			const size_t _end, long long & _timeSum, TVGenerator & _tvGenerator) const;
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVFileSplitter(const TVFileSettings & _fileSettings);
+	virtual ~TVFileSplitter();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	void SetThreadCount(const int _threadCount);
+	int GetThreadCount() const { return threadCount_; }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	static string GetShardPath(const string & _outputPrefix, const size_t _index);
+
+	long long CountVectors(const string & _inputPath) const;
+	vector<string> SplitByVectorCount(const string & _inputPath,
+			const string & _outputPrefix, const long long _vectorsPerShard) const;
+	vector<string> SplitBySize(const string & _inputPath,
+			const string & _outputPrefix, const long long _bytesPerShard) const;
+	long long Merge(const vector<string> & _inputPaths,
+			const string & _outputPath) const;
+};
+
+#endif /* TVFILESPLITTER_H_ */
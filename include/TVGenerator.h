@@ -39,13 +39,46 @@
 #include <string>
 #include <fstream>
 #include <vector>
+#include <map>
+#include <time.h>
 
 #include "SignalDeclaration.h"
 #include "StdLogicVector.h"
 #include "TVFileSettings.h"
+#include "TVHashBuffer.h"
+#include "TVStringView.h"
+#include "TVToggleCoverage.h"
+#include "TVVectorBuffer.h"
 
 using namespace std;
 
+/**
+ * @brief How thoroughly the TVGenerator validates the values written.
+ */
+enum TVValidationPolicy {
+	kValidateDefault,   // Check value count, file mode and times per line.
+	kValidateStrict,    // Additionally check the width and digits of every value.
+	kValidateRelease    // Check value count and file mode per line only.
+};
+
+/**
+ * @brief Number of buckets of the write latency histogram (bucket i counting
+ *   the writes taking [2^i, 2^(i+1)) nanoseconds).
+ */
+const int kWriteLatencyBucketCount = 32;
+
+/**
+ * @brief Statistics of a TVGenerator.
+ */
+struct TVGeneratorStats {
+	TVValidationPolicy validationPolicy;
+	long long testVectorCount;
+	long long stimuliCount;
+	long long expRspCount;
+	long long peakResidentKBytes;    // Peak resident set size of the process.
+	long long writeLatencyHistogram[kWriteLatencyBucketCount];  // Low-footprint mode only.
+};
+
 /**
  * @class TVGenerator
  * @author Michael Muehlberghuber (mbgh,michmueh)
@@ -66,26 +99,131 @@ private:
 	ofstream tvFile_;
 	ofstream stimFile_;
 	ofstream expRspFile_;
+	bool ownsStreams_;
+	ostream * tvStream_;
+	ostream * stimStream_;
+	ostream * expRspStream_;
+	TVHashBuffer tvHashBuffer_;
+	TVHashBuffer stimHashBuffer_;
+	TVHashBuffer expRspHashBuffer_;
+	ostream tvHashStream_;
+	ostream stimHashStream_;
+	ostream expRspHashStream_;
 	TVFileSettings tvFileSettings_;
 	TVFileSettings stimFileSettings_;
 	TVFileSettings expRspFileSettings_;
+	string tvCaption_;
+	string stimCaption_;
+	string expRspCaption_;
+	string tvHeader_;
+	string stimHeader_;
+	string expRspHeader_;
+	vector<string> tvRenderedValues_;
+	vector<string> stimRenderedValues_;
+	vector<string> expRspRenderedValues_;
+	vector<char> tvFileBuffer_;
+	vector<char> stimFileBuffer_;
+	vector<char> expRspFileBuffer_;
+	string checkpointPath_;
+	int checkpointInterval_;
+	time_t headerTime_;
+	string headerTimeString_;
+	TVToggleCoverage tvCoverage_;
+	TVToggleCoverage stimCoverage_;
+	TVToggleCoverage expRspCoverage_;
+	TVVectorBuffer tvVectorBuffer_;
+	TVVectorBuffer stimVectorBuffer_;
+	TVVectorBuffer expRspVectorBuffer_;
+	size_t vectorBufferSize_;
+	size_t commentBufferSize_;
+	bool isBackgroundFormatting_;
+	TVValidationPolicy validationPolicy_;
+	long long tvTime_;
+	long long stimTime_;
+	long long expRspTime_;
+	bool isLowFootprint_;
+	size_t fileBufferSize_;
+	long long writeLatencyHistogram_[kWriteLatencyBucketCount];
+
+	/**
+	 * @brief Records the latency of a write call in the histogram (in
+	 *   low-footprint mode) when going out of scope.
+	 */
+	class WriteTimer {
+	public:
+		WriteTimer(TVGenerator & _tvGenerator);
+		~WriteTimer();
+	private:
+		TVGenerator & tvGenerator_;
+		struct timespec start_;
+		WriteTimer(const WriteTimer &);
+		WriteTimer & operator=(const WriteTimer &);
+	};
 
 	// **************************************************************************
 	// Utility functions
 	// **************************************************************************
 	void WriteTVFileHeader();
-	void WriteTVFileHeader(ofstream & _tvFile, TVFileSettings & _fileSettings);
-	void WriteTVFileHeaderEntry(ofstream & _tvFile, TVFileSettings & _fileSettings,
-			string _prefix, string _entry);
-	int WriteTVLine(ofstream & _tvFile, TVFileSettings & _fileSettings,
-			vector<StdLogicVector> _signalValues, string _comment, int & _tvCount);
-	void WriteArbitraryTVLine(ofstream & _tvFile, TVFileSettings & _tvFileSettings,
-			string _line, string _comment);
-	void WriteTVCommentLine(ofstream & _tvFile, TVFileSettings & _tvFileSettings,
-			string _comment);
-	void WriteSignalCaptions(ofstream & _tvFile, TVFileSettings & _tvFileSettings);
-	string GeneratePreSignalCaptionString(const TVFileSettings & _tvFileSettings,
-			const int _sigIndex);
+	void WriteTVFileHeader(ostream & _tvFile, TVFileSettings & _fileSettings);
+	static string FormatHeaderTime(const time_t _time);
+	static string RenderTVFileHeader(const TVFileSettings & _tvFileSettings,
+			const string & _timeString, const bool _isWithFilePath);
+	static void WriteTVFileHeaderEntry(ostream & _tvFile,
+			const TVFileSettings & _fileSettings, const string & _prefix,
+			const string & _entry);
+	int WriteTVLine(ostream & _tvFile, TVFileSettings & _fileSettings,
+			vector<StdLogicVector> & _signalValues, const long long _time,
+			const TVStringView & _comment, int & _tvCount);
+	void ValidateSignalValues(vector<StdLogicVector> & _signalValues,
+			const TVFileSettings & _fileSettings);
+	const vector<string> & RenderSignalValues(vector<StdLogicVector> & _signalValues,
+			const TVFileSettings & _fileSettings);
+	vector<string> & GetRenderedValues(const TVFileSettings & _fileSettings);
+	void ReleaseUnusedFileSettings();
+	void ValidateLayout(const TVFileSettings & _fileSettings);
+	void FormatTVLine(ostream & _tvFile, TVFileSettings & _fileSettings,
+			vector<StdLogicVector> & _signalValues, const long long _timeValue,
+			const TVStringView & _comment, const int _tvCount);
+	void WriteLineEndComment(ostream & _tvFile, const TVFileSettings & _fileSettings,
+			const TVStringView & _comment);
+	void WriteArbitraryTVLine(ostream & _tvFile, TVFileSettings & _tvFileSettings,
+			const TVStringView & _line, const TVStringView & _comment);
+	void WriteTVCommentLine(ostream & _tvFile, TVFileSettings & _tvFileSettings,
+			const TVStringView & _comment);
+	void WriteSignalCaptions(ostream & _tvFile, const TVFileSettings & _tvFileSettings);
+	static string RenderSignalCaptions(const TVFileSettings & _fileSettings);
+	static string GeneratePreSignalCaptionString(const TVFileSettings & _tvFileSettings,
+			const vector<int> & _columnDigits, const int _columnIndex);
+	long long & GetLastTime(const TVFileSettings & _fileSettings);
+	long long ResolveTime(const TVFileSettings & _fileSettings, const long long _time);
+	long long EncodeTime(const TVFileSettings & _fileSettings, const long long _time);
+	void OpenFile(ofstream & _file, vector<char> & _buffer, const string & _filePath,
+			const ios_base::openmode _mode);
+	void AttachStream(ostream * & _stream, ostream & _target,
+			const TVFileSettings & _fileSettings, TVHashBuffer & _hashBuffer,
+			ostream & _hashStream);
+	void MaybeWriteCheckpoint();
+	void CheckpointFile(ostream & _checkpoint, const string & _prefix,
+			ostream & _stream, ofstream & _file, const TVFileSettings & _fileSettings,
+			const TVHashBuffer & _hashBuffer, const int _tvCount);
+	int ResumeFile(const map<string, string> & _checkpoint, const string & _prefix,
+			ostream * & _stream, ofstream & _file, vector<char> & _buffer,
+			const TVFileSettings & _fileSettings, TVHashBuffer & _hashBuffer,
+			ostream & _hashStream);
+	void RestartStream(ostream & _target, const TVFileSettings & _fileSettings,
+			TVHashBuffer & _hashBuffer);
+	TVToggleCoverage & GetToggleCoverage(const TVFileSettings & _fileSettings);
+	void UpdateToggleCoverage(const TVFileSettings & _fileSettings,
+			const TVStringView & _values);
+	void WriteToggleCoverageReport(ostream & _tvFile,
+			const TVFileSettings & _fileSettings);
+	TVVectorBuffer & GetVectorBuffer(const TVFileSettings & _fileSettings);
+	void WriteVectorBuffer(ostream & _tvFile, const TVFileSettings & _fileSettings,
+			TVVectorBuffer::Batch & _batch, const int _tvCount);
+	void FlushVectorBuffers();
+	void CheckBufferedComment(const TVStringView & _comment) const;
+	map<string, string> ReadCheckpoint();
+	void SyncFile(const string & _filePath);
 
 public:
 	// **************************************************************************
@@ -100,29 +238,82 @@ public:
 	int GetTVCount() const { return testVectorCount_; }
 	int GetStimuliCount() const { return stimuliCount_; }
 	int GetExpRspCount() const { return expRspCount_; }
+	uint64_t GetContentHash() const { return tvHashBuffer_.GetHash(); }
+	uint64_t GetStimuliContentHash() const { return stimHashBuffer_.GetHash(); }
+	uint64_t GetExpRspContentHash() const { return expRspHashBuffer_.GetHash(); }
+	const TVToggleCoverage & GetToggleCoverage() const { return tvCoverage_; }
+	const TVToggleCoverage & GetStimuliToggleCoverage() const { return stimCoverage_; }
+	const TVToggleCoverage & GetExpRspToggleCoverage() const { return expRspCoverage_; }
+	void SetValidationPolicy(const TVValidationPolicy _validationPolicy) {
+		validationPolicy_ = _validationPolicy; }
+	TVValidationPolicy GetValidationPolicy() const { return validationPolicy_; }
+	bool IsLowFootprint() const { return isLowFootprint_; }
+	TVGeneratorStats GetStats() const;
+
+	static string GetValidationPolicyName(const TVValidationPolicy _validationPolicy);
+
+	static long long EstimateFileSize(const TVFileSettings & _fileSettings,
+			const long long _vectorCount);
 
 	// **************************************************************************
 	// Public methods
 	// **************************************************************************
 	void Initialize(TVFileSettings _tvFileSettings);
 	void Initialize(TVFileSettings _stimFileSettings, TVFileSettings _expRespFileSettings);
+	void Initialize(TVFileSettings _tvFileSettings, ostream & _tvStream);
+	void Initialize(TVFileSettings _stimFileSettings, ostream & _stimStream,
+			TVFileSettings _expRspFileSettings, ostream & _expRspStream);
 	void Finalize();
+	void Restart(const string & _filePath);
+	void Restart(const string & _stimFilePath, const string & _expRspFilePath);
+
+	void EnableCheckpoints(const string & _checkpointPath, const int _interval);
+	void EnableVectorBuffer(const size_t _vectorCount, const size_t _commentBytes,
+			const bool _isBackgroundFormatting);
+	void EnableLowFootprint(const size_t _fileBufferSize);
+	void WriteCheckpoint();
+	int Resume(TVFileSettings _tvFileSettings);
+	int Resume(TVFileSettings _stimFileSettings, TVFileSettings _expRspFileSettings);
+
+	int WriteTestVectorLine(vector<StdLogicVector> & _signalValues,
+			const TVStringView & _comment);
+	int WriteTestVectorLine(vector<StdLogicVector> & _signalValues,
+			const long long _time, const TVStringView & _comment);
+	int WriteTestVectorLine(const vector<StdLogicVector> & _signalValues,
+			const TVStringView & _comment);
+	int WriteTestVectorLine(const vector<StdLogicVector> & _signalValues,
+			const long long _time, const TVStringView & _comment);
+	int WriteFormattedTestVectorLine(const TVStringView & _values,
+			const TVStringView & _comment);
+	int WriteFormattedTestVectorLine(const TVStringView & _values,
+			const long long _time, const TVStringView & _comment);
+	int WriteStimuliLine(vector<StdLogicVector> & _stimuliValues,
+			const TVStringView & _comment);
+	int WriteStimuliLine(vector<StdLogicVector> & _stimuliValues,
+			const long long _time, const TVStringView & _comment);
+	int WriteExpRspLine(vector<StdLogicVector> & _expRspValues,
+			const TVStringView & _comment);
+	int WriteExpRspLine(vector<StdLogicVector> & _expRspValues,
+			const long long _time, const TVStringView & _comment);
+	int WriteCycle(vector<StdLogicVector> & _stimuliValues,
+			vector<StdLogicVector> & _expRspValues, const TVStringView & _comment);
+	int WriteCycle(vector<StdLogicVector> & _stimuliValues,
+			vector<StdLogicVector> & _expRspValues, const long long _time,
+			const TVStringView & _comment);
+
+	void WriteArbitraryTVLine(const TVStringView & _line);
+	void WriteArbitraryTVLine(const TVStringView & _line,
+			const TVStringView & _comment);
+	void WriteArbitraryStimuliLine(const TVStringView & _line);
+	void WriteArbitraryStimuliLine(const TVStringView & _line,
+			const TVStringView & _comment);
+	void WriteArbitraryExpRspLine(const TVStringView & _line);
+	void WriteArbitraryExpRspLine(const TVStringView & _line,
+			const TVStringView & _comment);
 
-	int WriteTestVectorLine(vector<StdLogicVector> _signalValues,
-	    string _comment);
-	int WriteStimuliLine(vector<StdLogicVector> & _stimuliValues, string _comment);
-	int WriteExpRspLine(vector<StdLogicVector> & _expRspValues, string _comment);
-
-	void WriteArbitraryTVLine(string _line);
-	void WriteArbitraryTVLine(string _line, string _comment);
-	void WriteArbitraryStimuliLine(string _line);
-	void WriteArbitraryStimuliLine(string _line, string _comment);
-	void WriteArbitraryExpRspLine(string _line);
-	void WriteArbitraryExpRspLine(string _line, string _comment);
-
-	void WriteTVCommentLine(string _comment);
-	void WriteStimuliCommentLine(string _comment);
-	void WriteExpRspCommentLine(string _comment);
+	void WriteTVCommentLine(const TVStringView & _comment);
+	void WriteStimuliCommentLine(const TVStringView & _comment);
+	void WriteExpRspCommentLine(const TVStringView & _comment);
 };
 
 #endif /* TVGENERATOR_H_ */
@@ -0,0 +1,94 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVHashBuffer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief A stream buffer hashing all data passed through it.
+ * @version 0.1
+ */
+
+#ifndef TVHASHBUFFER_H_
+#define TVHASHBUFFER_H_
+
+#include <string>
+#include <streambuf>
+#include <stdint.h>
+
+using namespace std;
+
+/**
+ * @class TVHashBuffer
+ * @author agent
+ * @date 18 October 2026
+ * @brief Stream buffer computing a rolling hash of the data written.
+ * @version 0.1
+ *
+ * All data is forwarded to a target stream buffer. On the way, a 64-bit
+ * FNV-1a hash and the number of bytes are accumulated, hence, the hash of a
+ * test vector file is known as soon as it has been written, without reading it
+ * again.
+ */
+class TVHashBuffer : public streambuf {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	streambuf * target_;
+	uint64_t hash_;
+	long long byteCount_;
+	char buffer_[4096];
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	bool Forward();
+
+protected:
+	virtual int_type overflow(int_type _c);
+	virtual int sync();
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVHashBuffer();
+	virtual ~TVHashBuffer();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	uint64_t GetHash() const;
+	long long GetByteCount() const { return byteCount_ + (pptr() - pbase()); }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	void Reset(streambuf * _target);
+	void Reset(streambuf * _target, const uint64_t _hash, const long long _byteCount);
+
+	static uint64_t Hash(const char * _data, const size_t _length, uint64_t _hash);
+	static uint64_t Hash(const string & _data);
+	static string ToHexString(const uint64_t _hash);
+};
+
+#endif /* TVHASHBUFFER_H_ */
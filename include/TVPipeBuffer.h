@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVPipeBuffer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief A file descriptor sink for streaming test vectors to live consumers.
+ * @version 0.1
+ *
+ * This file provides a stream buffer writing test vectors to an already open
+ * file descriptor or a named pipe (FIFO), e.g., to feed a checker or waveform
+ * converter running as a separate process.
+ */
+
+#ifndef TVPIPEBUFFER_H_
+#define TVPIPEBUFFER_H_
+
+#include <string>
+#include <streambuf>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+using namespace std;
+
+/**
+ * @class TVPipeBuffer
+ * @author agent
+ * @date 18 October 2026
+ * @brief Stream buffer coalescing test vectors into pipe-sized writes.
+ * @version 0.1
+ *
+ * Wrap it into an @c ostream and hand it over to TVGenerator::Initialize():
+ *
+ * @code
+ * TVPipeBuffer pipe("/tmp/tv_fifo", 20);
+ * ostream pipeStream(&pipe);
+ * tvGenerator.Initialize(tvFileSettings, pipeStream);
+ * @endcode
+ *
+ * Data is collected in the put area until the pipe's buffer size is reached
+ * and then written as a single chunk. A background thread checks the buffer
+ * every half of the maximum latency and writes the data it could not
+ * guarantee to be written within the maximum latency otherwise, also while no
+ * further data arrives (e.g., while the model is busy computing). A negative
+ * maximum latency disables this.
+ *
+ * The stream writes into the put area without locking and hands the data over
+ * to the background thread with an atomic pointer. The writing thread only
+ * locks when the buffer is full or flushed. Partial writes are continued and
+ * non-blocking descriptors are waited for. If the reading side has gone away,
+ * @c SIGPIPE is suppressed, the buffer reports itself as broken and the
+ * stream goes bad.
+ */
+class TVPipeBuffer : public streambuf {
+
+public:
+	/**
+	 * @brief Monotonic clock returning milliseconds.
+	 */
+	typedef long long (*Clock)();
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	int fd_;
+	bool ownsFd_;
+	atomic<bool> broken_;
+	int maxLatencyMs_;
+	Clock clock_;
+	vector<char> buffer_;
+	char * flushed_;                  // End of the data written so far.
+	atomic<char *> committed_;        // End of the data handed over so far.
+	long long idleSinceMs_;           // Last time no data was pending.
+	mutex mutex_;                     // Guards writing and flushed_.
+	condition_variable wakeUp_;
+	thread flusher_;
+	bool stop_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	void Init();
+	bool WriteAll(const char * _data, size_t _length);
+	bool WriteCommitted(char * _end);
+	bool Put(const char * _data, size_t _length);
+	int GetCheckIntervalMs() const;
+	void RunFlusher();
+
+protected:
+	virtual int_type overflow(int_type _c);
+	virtual streamsize xsputn(const char * _data, streamsize _length);
+	virtual int sync();
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVPipeBuffer(const int _fd, const int _maxLatencyMs,
+			const Clock _clock = NULL);
+	TVPipeBuffer(const string & _fifoPath, const int _maxLatencyMs,
+			const Clock _clock = NULL);
+	virtual ~TVPipeBuffer();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	int GetFd() const { return fd_; }
+	size_t GetChunkSize() const { return buffer_.size(); }
+	bool IsBroken() const { return broken_; }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	void FlushExpired();
+};
+
+#endif /* TVPIPEBUFFER_H_ */
@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVRingBuffer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief A shared-memory ring buffer sink for test vectors.
+ * @version 0.1
+ *
+ * This file provides a stream buffer publishing the formatted test vector
+ * lines into a POSIX shared memory segment. A simulator running concurrently
+ * can pull the lines using the C interface declared in TVRingConsumer.h,
+ * hence, no test vector file has to be written to disk at all.
+ */
+
+#ifndef TVRINGBUFFER_H_
+#define TVRINGBUFFER_H_
+
+#include <string>
+#include <streambuf>
+
+#include "TVRingConsumer.h"
+
+using namespace std;
+
+/**
+ * @class TVRingBuffer
+ * @author agent
+ * @date 18 October 2026
+ * @brief Producer side of a shared-memory test vector ring buffer.
+ * @version 0.1
+ *
+ * Wrap it into an @c ostream and hand it over to TVGenerator::Initialize():
+ *
+ * @code
+ * TVRingBuffer ring("/tv_ring", 1 << 20);
+ * ostream ringStream(&ring);
+ * tvGenerator.Initialize(tvFileSettings, ringStream);
+ * ...
+ * tvGenerator.Finalize();
+ * ring.Close();
+ * @endcode
+ *
+ * Data is published to the consumer as soon as a line is complete (or, with
+ * a publish threshold, once that many bytes of complete lines are pending),
+ * whenever the stream is flushed and whenever the local buffer (4 KiB) runs
+ * full. Line ends are detected in the character sequences written to the
+ * stream (i.e., by every @c << including @c '\n'), not in single characters
+ * written via @c put(). If the ring is full, the producer waits for
+ * the consumer to catch up. The wait fails if the consumer process has died
+ * or closed the ring, or if it did not free any space within the timeout
+ * (e.g., because it never attached). The buffer then reports itself as broken
+ * and the stream goes bad.
+ */
+class TVRingBuffer : public streambuf {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	string name_;
+	size_t capacity_;
+	size_t mapSize_;
+	int fd_;
+	TVRingHeader * header_;
+	char * data_;
+	char buffer_[4096];
+	size_t publishThreshold_;
+	int timeoutMs_;
+	bool broken_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	bool Publish(const char * _data, size_t _length);
+	bool IsConsumerGone() const;
+
+protected:
+	virtual int_type overflow(int_type _c);
+	virtual streamsize xsputn(const char * _s, streamsize _n);
+	virtual int sync();
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVRingBuffer(const string & _name, const size_t _capacity);
+	virtual ~TVRingBuffer();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	string GetName() const { return name_; }
+	size_t GetCapacity() const { return capacity_; }
+	void SetPublishThreshold(const size_t _publishThreshold) {
+		publishThreshold_ = _publishThreshold; }
+	size_t GetPublishThreshold() const { return publishThreshold_; }
+	void SetTimeout(const int _timeoutMs) { timeoutMs_ = _timeoutMs; }
+	int GetTimeout() const { return timeoutMs_; }
+	bool IsBroken() const { return broken_; }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	void Close();
+};
+
+#endif /* TVRINGBUFFER_H_ */
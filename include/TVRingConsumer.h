@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVRingConsumer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief C interface for reading test vectors from a shared-memory ring.
+ * @version 0.1
+ *
+ * This file provides a plain C interface to the consumer side of a
+ * @c TVRingBuffer. It is intended to be called from a SystemVerilog test bench
+ * via DPI-C, e.g.:
+ *
+ * @code
+ * import "DPI-C" function chandle tvring_open(input string name);
+ * import "DPI-C" function string  tvring_next_vector(input chandle ring,
+ *                                                    input string commentInd);
+ * import "DPI-C" function int     tvring_error(input chandle ring);
+ * import "DPI-C" function void    tvring_close(input chandle ring);
+ * @endcode
+ *
+ * The layout of the shared memory segment is declared here as well, since
+ * both the producer and the consumer have to agree on it.
+ */
+
+#ifndef TVRINGCONSUMER_H_
+#define TVRINGCONSUMER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic number identifying a test vector ring buffer segment. */
+#define TVRING_MAGIC 0x545652494e473031ULL
+
+/** Consumer process id marking a ring the consumer has closed. */
+#define TVRING_DETACHED 0xffffffffU
+
+/**
+ * @brief Header at the beginning of the shared memory segment.
+ *
+ * The read and write positions increase monotonically, the actual index into
+ * the data area is the position modulo the (power of two) capacity. They are
+ * kept on separate cache lines since each of them is written by one side only.
+ */
+struct TVRingHeader {
+	uint64_t magic;
+	uint64_t capacity;
+	uint32_t closed;          /* Set by the producer once no data follows. */
+	uint32_t consumer;        /* Process id of the consumer, 0 before it attached,
+	                             TVRING_DETACHED after it closed the ring. */
+	char     pad0[40];
+	uint64_t head;            /* Write position, owned by the producer. */
+	char     pad1[56];
+	uint64_t tail;            /* Read position, owned by the consumer. */
+	char     pad2[56];
+};
+
+typedef struct tvring tvring_t;
+
+tvring_t *   tvring_open(const char * name);
+const char * tvring_next_line(tvring_t * ring);
+const char * tvring_next_vector(tvring_t * ring, const char * commentIndicator);
+int          tvring_error(const tvring_t * ring);
+void         tvring_close(tvring_t * ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TVRINGCONSUMER_H_ */
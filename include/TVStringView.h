@@ -0,0 +1,86 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVStringView.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief A non-owning reference to a string.
+ * @version 0.1
+ */
+
+#ifndef TVSTRINGVIEW_H_
+#define TVSTRINGVIEW_H_
+
+#include <string>
+#include <cstring>
+#include <ostream>
+
+using namespace std;
+
+/**
+ * @class TVStringView
+ * @author agent
+ * @date 18 October 2026
+ * @brief Non-owning reference to a string (pointer and length).
+ * @version 0.1
+ *
+ * Used for the lines and comments passed to the TVGenerator, so both
+ * strings and string literals/C strings can be passed without creating a
+ * temporary string. The referenced characters must stay valid as long as the
+ * view is used.
+ */
+class TVStringView {
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	const char * data_;
+	size_t size_;
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVStringView() : data_(""), size_(0) {}
+	TVStringView(const char * _data) : data_(_data), size_(strlen(_data)) {}
+	TVStringView(const char * _data, const size_t _size) : data_(_data),
+			size_(_size) {}
+	TVStringView(const string & _string) : data_(_string.data()),
+			size_(_string.size()) {}
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	const char * data() const { return data_; }
+	size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	string str() const { return string(data_, size_); }
+};
+
+/**
+ * @brief Write the referenced characters to a stream.
+ */
+inline ostream & operator<<(ostream & _os, const TVStringView & _view) {
+	return _os.write(_view.data(), _view.size());
+}
+
+#endif /* TVSTRINGVIEW_H_ */
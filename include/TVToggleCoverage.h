@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVToggleCoverage.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief Per-bit toggle coverage of the signals of a test vector file.
+ * @version 0.1
+ */
+
+#ifndef TVTOGGLECOVERAGE_H_
+#define TVTOGGLECOVERAGE_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <stdint.h>
+
+#include "TVFileSettings.h"
+#include "TVStringView.h"
+
+using namespace std;
+
+/**
+ * @class TVToggleCoverage
+ * @author agent
+ * @date 18 October 2026
+ * @brief Toggle coverage collected while writing test vectors.
+ * @version 0.1
+ *
+ * Every value is packed into 64-bit words and XORed with the previous value of
+ * the same signal. Only the bits which actually toggled are visited in order
+ * to count their rising (0->1) and falling (1->0) transitions; the total number
+ * of toggles per signal is accumulated using a population count. A bit counts
+ * as covered once it has seen both transitions.
+ *
+ * Don't care values are not compared against their neighbours, i.e., a
+ * transition across a don't care value is not counted. Optionally, the number
+ * of don't care values is counted per signal.
+ */
+class TVToggleCoverage {
+
+private:
+	/**
+	 * @brief Coverage state of a single signal.
+	 */
+	struct SignalCoverage {
+		string name;
+		int width;
+		int printBase;
+		bool hasPrevious;
+		vector<uint64_t> previous;
+		vector<uint64_t> current;
+		vector<long long> riseCounts;
+		vector<long long> fallCounts;
+		long long toggleCount;
+		long long dontCareCount;
+	};
+
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	vector<SignalCoverage> signals_;
+	long long vectorCount_;
+	long long firstVector_;       // Index of the first test vector covered.
+	bool isCountDontCares_;
+	bool isActive_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	void Pack(SignalCoverage & _signal, const TVStringView & _digits);
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVToggleCoverage();
+	virtual ~TVToggleCoverage();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	bool IsActive() const { return isActive_; }
+	long long GetVectorCount() const { return vectorCount_; }
+	long long GetFirstVector() const { return firstVector_; }
+	void SetFirstVector(const long long _firstVector) { firstVector_ = _firstVector; }
+	size_t GetSignalCount() const { return signals_.size(); }
+	long long GetRiseCount(const size_t _sigIndex, const int _bit) const {
+		return signals_[_sigIndex].riseCounts[_bit]; }
+	long long GetFallCount(const size_t _sigIndex, const int _bit) const {
+		return signals_[_sigIndex].fallCounts[_bit]; }
+	long long GetToggleCount(const size_t _sigIndex) const {
+		return signals_[_sigIndex].toggleCount; }
+	long long GetDontCareCount(const size_t _sigIndex) const {
+		return signals_[_sigIndex].dontCareCount; }
+	int GetCoveredBitCount(const size_t _sigIndex) const;
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	void Reset(const TVFileSettings & _fileSettings);
+	void Clear();
+	void Update(const size_t _sigIndex, const TVStringView & _digits);
+	void UpdateDontCare(const size_t _sigIndex);
+	void NextVector() { vectorCount_++; }
+	void WriteReport(ostream & _os, const string & _commentIndicator);
+};
+
+#endif /* TVTOGGLECOVERAGE_H_ */
@@ -0,0 +1,129 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVTransformer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief Rewrites existing test vector files to a different layout.
+ * @version 0.1
+ *
+ * This file provides a class for creating variants of test vector files
+ * written by the TVGenerator (e.g., different number bases, a subset or a
+ * different order of the signals, without line-end comments) without having
+ * to run the software model again.
+ */
+
+#ifndef TVTRANSFORMER_H_
+#define TVTRANSFORMER_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "TVFileSettings.h"
+#include "TVGenerator.h"
+
+using namespace std;
+
+/**
+ * @class TVTransformer
+ * @author agent
+ * @date 18 October 2026
+ * @brief Test vector file transformer.
+ * @version 0.1
+ *
+ * The source settings describe the file to be read (signal declarations incl.
+ * print bases, comment indicator and don't care identifier), the target
+ * settings the file to be written. Target signals are looked up by name in the
+ * source declarations and must have the same width.
+ *
+ * All lines starting with the source comment indicator (file header, signal
+ * captions, comment lines) are dropped; the target file gets a new header and
+ * captions at its own caption interval. Any other non-empty line has to be a
+ * test vector line. The lines are transformed in chunks on multiple threads
+ * and written in their original order.
+ *
+ * If the source settings enable the time column, the first value of every line
+ * is its time (absolute or delta encoded according to the source settings).
+ * The times are carried over to the time column of the target file (again
+ * encoded according to the target settings), without a source time column
+ * the test vectors are one time unit apart.
+ */
+class TVTransformer {
+
+private:
+	/**
+	 * @brief A single test vector line in the target layout.
+	 */
+	struct TransformedLine {
+		string values;
+		string comment;
+		long long time;               // Value of the source time column (if any).
+	};
+
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	TVFileSettings sourceSettings_;
+	TVFileSettings targetSettings_;
+	vector<int> signalMap_;       // Source signal index of every target signal.
+	int threadCount_;
+	size_t chunkSize_;            // Number of lines per chunk.
+	bool keepComments_;
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	void BuildSignalMap();
+	void TransformChunk(const vector<string> & _lines, const long long _firstLine,
+			vector<TransformedLine> & _result, string & _error) const;
+	bool TransformLine(const string & _line, vector<string> & _tokens,
+			TransformedLine & _result) const;
+	string ConvertValue(const string & _digits, const int _sourceBase,
+			const int _targetBase, const int _width) const;
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVTransformer(const TVFileSettings & _sourceSettings,
+			const TVFileSettings & _targetSettings);
+	virtual ~TVTransformer();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	void SetThreadCount(const int _threadCount);
+	void SetChunkSize(const size_t _chunkSize);
+	void SetKeepComments(const bool _keepComments) { keepComments_ = _keepComments; }
+	int GetThreadCount() const { return threadCount_; }
+	size_t GetChunkSize() const { return chunkSize_; }
+	bool IsKeepComments() const { return keepComments_; }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	long long Transform(const string & _inputPath);
+	long long Transform(const string & _inputPath, ostream & _output);
+	long long Transform(const string & _inputPath, TVGenerator & _tvGenerator);
+};
+
+#endif /* TVTRANSFORMER_H_ */
@@ -0,0 +1,176 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVVectorBuffer.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief An in-memory store for test vectors awaiting their formatting.
+ * @version 0.1
+ */
+
+#ifndef TVVECTORBUFFER_H_
+#define TVVECTORBUFFER_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "SignalDeclaration.h"
+#include "StdLogicVector.h"
+#include "TVStringView.h"
+
+using namespace std;
+
+/**
+ * @class TVVectorBuffer
+ * @author agent
+ * @date 18 October 2026
+ * @brief Double-buffered store of test vectors for deferred formatting.
+ * @version 0.1
+ *
+ * The test vectors are appended to one of two preallocated batches. A batch
+ * keeps its values column by column, i.e., the values of a signal are
+ * adjacent in a single contiguous array. Appending a test vector only copies
+ * its values into existing slots (StdLogicVector provides its value in
+ * rendered form only, hence the values themselves are stored) and its
+ * comment into an arena. Once the batch is full, it is dispatched to the
+ * writer given to Reset() and the other batch continues to be filled. The
+ * writer renders the batch column by column, i.e., with the same print base
+ * and width for a whole run of adjacent values. In background mode, a
+ * persistent worker thread runs the writer, i.e., batch N is formatted and
+ * written while batch N+1 fills up. Dispatching waits for the previous batch
+ * only.
+ *
+ * The memory used is bounded by the vector capacity and the comment capacity
+ * given to Reset() (twice). A test vector whose comment does not fit into the
+ * arena anymore has to wait for the next batch (only a single comment
+ * exceeding the whole arena makes it grow). Test vectors which have not been
+ * dispatched when the buffer is destroyed are discarded.
+ */
+class TVVectorBuffer {
+
+public:
+	/**
+	 * @brief A batch of test vectors (stored column by column).
+	 */
+	class Batch {
+	private:
+		size_t signalCount_;
+		size_t capacity_;
+		size_t commentCapacity_;
+		vector<StdLogicVector> values_;   // capacity_ values per signal.
+		vector<string> rendered_;         // Rendered values, same layout.
+		vector<char> isDontCare_;         // Don't care flags, same layout.
+		vector<long long> times_;         // Time column value of every test vector.
+		string commentArena_;
+		vector<size_t> commentEnds_;      // End of every comment within the arena.
+		size_t size_;
+
+	public:
+		Batch();
+		void Reset(const vector<SignalDeclaration> & _sigDecls, const size_t _capacity,
+				const size_t _commentCapacity);
+		bool IsEmpty() const { return size_ == 0; }
+		bool IsFull() const { return size_ == capacity_; }
+		bool CanAppend(const TVStringView & _comment) const {
+			return size_ < capacity_ && (size_ == 0 ||
+					commentArena_.size() + _comment.size() <= commentCapacity_); }
+		size_t GetSize() const { return size_; }
+		size_t GetSignalCount() const { return signalCount_; }
+		const string & GetRendered(const size_t _row, const size_t _sigIndex) const {
+			return rendered_[_sigIndex * capacity_ + _row]; }
+		bool IsDontCare(const size_t _row, const size_t _sigIndex) const {
+			return isDontCare_[_sigIndex * capacity_ + _row] != 0; }
+		long long GetTime(const size_t _row) const { return times_[_row]; }
+		TVStringView GetComment(const size_t _row) const;
+		void Append(const vector<StdLogicVector> & _signalValues, const long long _time,
+				const TVStringView & _comment);
+		void Render(const vector<SignalDeclaration> & _sigDecls,
+				const char _dontCareIdentifier);
+		void Clear();
+	};
+
+	/**
+	 * @brief Formats and writes a batch, given the number of test vectors of
+	 *   the file incl. the batch.
+	 */
+	typedef function<void(Batch &, const int)> Writer;
+
+private:
+	// **************************************************************************
+	// Members
+	// **************************************************************************
+	Batch batches_[2];
+	Batch * filling_;
+	Batch * pending_;
+	size_t capacity_;
+	Writer writer_;
+	bool isBackground_;
+	thread worker_;
+	mutex mutex_;
+	condition_variable cond_;
+	bool hasJob_;                     // The pending batch awaits the worker.
+	bool stop_;
+	int jobTVCount_;
+	exception_ptr error_;             // Error raised by the worker.
+
+	// **************************************************************************
+	// Utility functions
+	// **************************************************************************
+	void RunWorker();
+	void StopWorker();
+
+public:
+	// **************************************************************************
+	// Constructors/Destructors
+	// **************************************************************************
+	TVVectorBuffer();
+	virtual ~TVVectorBuffer();
+
+	// **************************************************************************
+	// Getter/Setter
+	// **************************************************************************
+	bool IsEnabled() const { return capacity_ > 0; }
+	bool IsEmpty() const { return filling_->IsEmpty(); }
+	bool IsFull() const { return filling_->IsFull(); }
+	bool CanAppend(const TVStringView & _comment) const {
+		return filling_->CanAppend(_comment); }
+	size_t GetCapacity() const { return capacity_; }
+	bool IsBackground() const { return isBackground_; }
+
+	// **************************************************************************
+	// Public methods
+	// **************************************************************************
+	void Reset(const vector<SignalDeclaration> & _sigDecls, const size_t _capacity,
+			const size_t _commentCapacity, const bool _isBackground,
+			const Writer & _writer);
+	void Append(const vector<StdLogicVector> & _signalValues, const long long _time,
+			const TVStringView & _comment) {
+		filling_->Append(_signalValues, _time, _comment); }
+	void Dispatch(const int _tvCount);
+	void Wait();
+};
+
+#endif /* TVVECTORBUFFER_H_ */
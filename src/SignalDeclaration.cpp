@@ -26,6 +26,8 @@
  * @version 0.1
  */
 
+#include <math.h>
+
 #include "SignalDeclaration.h"
 
 // ****************************************************************************
@@ -81,3 +83,30 @@ SignalDeclaration::SignalDeclaration(const string _name, const int _width,
  */
 SignalDeclaration::~SignalDeclaration() {
 }
+
+// ****************************************************************************
+// Getter/Setter
+// ****************************************************************************
+/**
+ * @brief Number of digits required to print a signal of the given width in the
+ *   given base (i.e., the width of its column in a test vector file).
+ * @param _width The width of the signal in bits.
+ * @param _printBase The number base the signal is printed in.
+ * @return The number of digits.
+ */
+int SignalDeclaration::DigitCount(const int _width, const int _printBase) {
+	const float logBase = log(_printBase) / log(2);
+	return (int)ceil((float)_width / logBase);
+}
+
+/**
+ * @brief Value of a single digit character (in any base up to 36).
+ * @param _c The digit character (case-insensitive).
+ * @return The value of the digit, or -1 if it is none.
+ */
+int SignalDeclaration::DigitValue(const char _c) {
+	if (_c >= '0' && _c <= '9') return _c - '0';
+	if (_c >= 'a' && _c <= 'z') return _c - 'a' + 10;
+	if (_c >= 'A' && _c <= 'Z') return _c - 'A' + 10;
+	return -1;
+}
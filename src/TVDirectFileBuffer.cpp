@@ -0,0 +1,399 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVDirectFileBuffer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief A Linux file writer for huge test vector files.
+ * @version 0.1
+ *
+ * This file provides the implementation of the asynchronous, page-aligned
+ * file writer. All blocks but the last one are written at aligned offsets,
+ * hence, the file can be opened using @c O_DIRECT.
+ */
+
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "TVDirectFileBuffer.h"
+
+using namespace std;
+
+/** Alignment required for @c O_DIRECT transfers. */
+static const size_t kDirectAlignment = 4096;
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Constructor using four blocks of 1 MiB each.
+ * @param _filePath The path of the file to be written.
+ * @param _expectedSize The expected size of the file in bytes, used to
+ *   preallocate it. Use 0 to disable preallocation.
+ * @param _bypassPageCache Whether the written data should be kept out of the
+ *   page cache.
+ */
+TVDirectFileBuffer::TVDirectFileBuffer(const string & _filePath,
+		const long long _expectedSize, const bool _bypassPageCache) :
+		filePath_(_filePath), fd_(-1), isDirect_(false), dropCache_(false),
+		isClosed_(false), error_(0), blockSize_(1 << 20), offset_(0),
+		inFlight_(0), stopWriter_(false) {
+	Init(_expectedSize, _bypassPageCache, 4);
+}
+
+/**
+ * @copydoc TVDirectFileBuffer::TVDirectFileBuffer(const string & _filePath,
+ *   const long long _expectedSize, const bool _bypassPageCache)
+ * @param _blockSize The size of a single block in bytes (rounded up to the
+ *   alignment of 4 KiB).
+ * @param _blockCount The number of blocks (at least two, one being filled
+ *   while the other one is written).
+ */
+TVDirectFileBuffer::TVDirectFileBuffer(const string & _filePath,
+		const long long _expectedSize, const bool _bypassPageCache,
+		const size_t _blockSize, const int _blockCount) :
+		filePath_(_filePath), fd_(-1), isDirect_(false), dropCache_(false),
+		isClosed_(false), error_(0),
+		blockSize_((_blockSize + kDirectAlignment - 1) & ~(kDirectAlignment - 1)),
+		offset_(0), inFlight_(0), stopWriter_(false) {
+	if (_blockCount < 2 || _blockSize == 0) {
+		throw invalid_argument("The direct file writer requires at least two "
+				"blocks of non-zero size.");
+	}
+	Init(_expectedSize, _bypassPageCache, _blockCount);
+}
+
+/**
+ * @brief Destructor closes the file (if not done yet) and frees the blocks.
+ */
+TVDirectFileBuffer::~TVDirectFileBuffer() {
+	try {
+		Close();
+	} catch (const exception &) {
+		// Errors are reported by an explicit call to Close() only.
+	}
+	for (size_t i = 0; i < buffers_.size(); ++i) {
+		free(buffers_[i]);
+	}
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Open and preallocate the file, allocate the blocks and start the
+ *   writer thread.
+ */
+void TVDirectFileBuffer::Init(const long long _expectedSize,
+		const bool _bypassPageCache, const int _blockCount) {
+
+	int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+	if (_bypassPageCache) {
+		fd_ = open(filePath_.c_str(), flags | O_DIRECT, 0644);
+		isDirect_ = (fd_ >= 0);
+	}
+#endif
+	if (fd_ < 0) {
+		// Either no bypass requested or the file system refused O_DIRECT (e.g.,
+		// tmpfs). In the latter case drop the written ranges from the cache.
+		fd_ = open(filePath_.c_str(), flags, 0644);
+		dropCache_ = _bypassPageCache;
+	}
+	if (fd_ < 0) {
+		throw runtime_error("Unable to open test vector file '" + filePath_ +
+				"': " + strerror(errno));
+	}
+
+#ifdef __linux__
+	// Preallocation is only a hint; file systems not supporting it are fine.
+	if (_expectedSize > 0) {
+		fallocate(fd_, 0, 0, _expectedSize);
+	}
+#else
+	(void)_expectedSize;
+#endif
+
+	// The destructor does not run if the constructor fails, hence, release the
+	// descriptor and the blocks allocated so far here.
+	try {
+		for (int i = 0; i < _blockCount; ++i) {
+			void * block = NULL;
+			if (posix_memalign(&block, kDirectAlignment, blockSize_) != 0) {
+				throw bad_alloc();
+			}
+			buffers_.push_back(static_cast<char *>(block));
+		}
+		freeBuffers_.assign(buffers_.begin() + 1, buffers_.end());
+		setp(buffers_[0], buffers_[0] + blockSize_);
+
+		writer_ = thread(&TVDirectFileBuffer::WriterLoop, this);
+	} catch (...) {
+		for (size_t i = 0; i < buffers_.size(); ++i) {
+			free(buffers_[i]);
+		}
+		buffers_.clear();
+		freeBuffers_.clear();
+		close(fd_);
+		fd_ = -1;
+		throw;
+	}
+}
+
+/**
+ * @brief Body of the writer thread: write the submitted blocks in order and
+ *   hand them back to the pool afterwards. Blocks queued in the meantime are
+ *   written by a single system call.
+ */
+void TVDirectFileBuffer::WriterLoop() {
+	vector<WriteRequest> requests;
+	requests.reserve(buffers_.size());
+	unique_lock<mutex> lock(mutex_);
+
+	for (;;) {
+		while (pending_.empty() && !stopWriter_) {
+			cond_.wait(lock);
+		}
+		if (pending_.empty()) {
+			return;
+		}
+
+		// The blocks are submitted in order, hence, they are contiguous.
+		requests.clear();
+		while (!pending_.empty() && requests.size() < IOV_MAX) {
+			requests.push_back(pending_.front());
+			pending_.pop_front();
+		}
+		inFlight_ += requests.size();
+
+		lock.unlock();
+		const int error = WriteBlocks(&requests[0], requests.size());
+		lock.lock();
+
+		if (error != 0 && error_ == 0) {
+			error_ = error;
+		}
+		inFlight_ -= requests.size();
+		for (size_t i = 0; i < requests.size(); ++i) {
+			freeBuffers_.push_back(requests[i].data);
+		}
+		cond_.notify_all();
+	}
+}
+
+/**
+ * @brief Write contiguous blocks to the file using @c pwritev.
+ * @param _requests The blocks to be written in ascending order of their
+ *   offsets.
+ * @param _count The number of blocks (at most @c IOV_MAX).
+ * @return 0 if successfully, the error number otherwise.
+ */
+int TVDirectFileBuffer::WriteBlocks(const WriteRequest * _requests,
+		const size_t _count) {
+	struct iovec iov[IOV_MAX];
+	size_t length = 0;
+	for (size_t i = 0; i < _count; ++i) {
+		iov[i].iov_base = _requests[i].data;
+		iov[i].iov_len	= _requests[i].length;
+		length += _requests[i].length;
+	}
+
+	// Continue partial writes behind the data written so far.
+	struct iovec * next = iov;
+	int remaining = _count;
+	size_t done = 0;
+	while (done < length) {
+		ssize_t written = pwritev(fd_, next, remaining, _requests[0].offset + done);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return errno;
+		}
+		done += written;
+		while (remaining > 0 && (size_t)written >= next->iov_len) {
+			written -= next->iov_len;
+			next++;
+			remaining--;
+		}
+		if (remaining > 0) {
+			next->iov_base = static_cast<char *>(next->iov_base) + written;
+			next->iov_len  -= written;
+		}
+	}
+
+#ifdef __linux__
+	if (dropCache_) {
+		sync_file_range(fd_, _requests[0].offset, length,
+				SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+				SYNC_FILE_RANGE_WAIT_AFTER);
+		posix_fadvise(fd_, _requests[0].offset, length, POSIX_FADV_DONTNEED);
+	}
+#endif
+	return 0;
+}
+
+/**
+ * @brief Hand the current block over to the writer thread and continue with
+ *   the next free block.
+ * @return False if a previous write failed.
+ */
+bool TVDirectFileBuffer::Submit() {
+	unique_lock<mutex> lock(mutex_);
+
+	const size_t length = pptr() - pbase();
+	if (length > 0) {
+		WriteRequest request = { pbase(), length, offset_ };
+		pending_.push_back(request);
+		offset_ += length;
+		cond_.notify_all();
+
+		while (freeBuffers_.empty() && error_ == 0) {
+			cond_.wait(lock);
+		}
+		if (error_ == 0) {
+			char * next = freeBuffers_.back();
+			freeBuffers_.pop_back();
+			setp(next, next + blockSize_);
+		}
+	}
+	return error_ == 0;
+}
+
+/**
+ * @brief Wait until all submitted blocks have been written.
+ * @return False if any write failed.
+ */
+bool TVDirectFileBuffer::WaitForWriter() {
+	unique_lock<mutex> lock(mutex_);
+	while ((!pending_.empty() || inFlight_ > 0) && error_ == 0) {
+		cond_.wait(lock);
+	}
+	return error_ == 0;
+}
+
+/**
+ * @brief Submit the current block once it is full.
+ * @param _c The character which did not fit into the block anymore.
+ * @return @c traits_type::eof() if writing failed.
+ */
+TVDirectFileBuffer::int_type TVDirectFileBuffer::overflow(int_type _c) {
+	if (isClosed_ || !Submit()) {
+		return traits_type::eof();
+	}
+	if (!traits_type::eq_int_type(_c, traits_type::eof())) {
+		*pptr() = traits_type::to_char_type(_c);
+		pbump(1);
+	}
+	return traits_type::not_eof(_c);
+}
+
+/**
+ * @brief Wait for all submitted blocks and write the partially filled current
+ *   block as well, so that the data is in the file (e.g., before writing a
+ *   checkpoint).
+ *
+ * In order to keep all offsets aligned, the current block is padded with
+ * zeros up to the alignment and written at its final offset. It continues to
+ * be filled afterwards and is written again (including the new data) once
+ * it is full or the stream is flushed again. The padding is removed by
+ * Close(). A resumed run continues at the offset stored in the checkpoint.
+ *
+ * @return 0 if successfully, -1 otherwise.
+ */
+int TVDirectFileBuffer::sync() {
+	if (!WaitForWriter()) {
+		return -1;
+	}
+	const size_t tailLength = pptr() - pbase();
+	if (isClosed_ || tailLength == 0) {
+		return 0;
+	}
+
+	const size_t paddedLength = (tailLength + kDirectAlignment - 1) &
+			~(kDirectAlignment - 1);
+	memset(pptr(), 0, paddedLength - tailLength);
+	WriteRequest request = { pbase(), paddedLength, offset_ };
+	lock_guard<mutex> lock(mutex_);
+	error_ = WriteBlocks(&request, 1);
+	return error_ == 0 ? 0 : -1;
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Write the remaining data, stop the writer thread and truncate the
+ *   (possibly preallocated) file to its actual size.
+ */
+void TVDirectFileBuffer::Close() {
+	if (isClosed_) {
+		return;
+	}
+	isClosed_ = true;
+
+	const size_t tailLength = pptr() - pbase();
+	char * tail = pbase();
+	WaitForWriter();
+
+	{
+		lock_guard<mutex> lock(mutex_);
+		stopWriter_ = true;
+		cond_.notify_all();
+	}
+	writer_.join();
+
+	// The last block is generally not a multiple of the alignment, hence, it is
+	// written without O_DIRECT.
+	if (tailLength > 0 && error_ == 0) {
+#ifdef O_DIRECT
+		if (isDirect_) {
+			fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) & ~O_DIRECT);
+		}
+#endif
+		WriteRequest request = { tail, tailLength, offset_ };
+		error_ = WriteBlocks(&request, 1);
+		offset_ += tailLength;
+	}
+	setp(NULL, NULL);
+
+	if (ftruncate(fd_, offset_) != 0 && error_ == 0) {
+		error_ = errno;
+	}
+	close(fd_);
+
+	if (error_ != 0) {
+		throw runtime_error("Unable to write test vector file '" + filePath_ +
+				"': " + strerror(error_));
+	}
+}
@@ -0,0 +1,299 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVFileCache.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief A cache for test vector files.
+ * @version 0.1
+ */
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "TVFileCache.h"
+#include "TVHashBuffer.h"
+
+using namespace std;
+
+/** Prefix of the content hash line within a description file. */
+static const string kContentHashPrefix = "content-hash=";
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Constructor, which creates the cache directory if necessary.
+ * @param _directory The directory holding the cache entries.
+ */
+TVFileCache::TVFileCache(const string & _directory) : directory_(_directory),
+		useHardLinks_(false) {
+	if (mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST) {
+		throw runtime_error("Unable to create cache directory '" + directory_ +
+				"': " + strerror(errno));
+	}
+}
+
+/**
+ * @brief Destructor
+ */
+TVFileCache::~TVFileCache() {
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Get the path of the cached test vector file of an entry.
+ * @param _key The key of the entry.
+ */
+string TVFileCache::GetEntryPath(const string & _key) const {
+	return directory_ + "/" + _key + ".tv";
+}
+
+/**
+ * @brief Get the path of the description file of an entry.
+ * @param _key The key of the entry.
+ */
+string TVFileCache::GetDescriptionPath(const string & _key) const {
+	return directory_ + "/" + _key + ".key";
+}
+
+/**
+ * @brief Describe everything the content of a test vector file depends on.
+ * @param _fileSettings The settings of the test vector file.
+ * @param _fingerprint The fingerprint of the generating model.
+ * @return The description (one property per line).
+ */
+string TVFileCache::Describe(const TVFileSettings & _fileSettings,
+		const string & _fingerprint) {
+	stringstream ssResult;
+
+	ssResult << "fingerprint=" << _fingerprint << '\n';
+	ssResult << "project=" << _fileSettings.getProjectName() << '\n';
+	ssResult << "content=" << _fileSettings.getContent() << '\n';
+	ssResult << "author=" << _fileSettings.getAuthor() << '\n';
+	ssResult << "comment-indicator=" << _fileSettings.getCommentIndicator() << '\n';
+	ssResult << "column-indicator=" << _fileSettings.getColumnIndicator() << '\n';
+	ssResult << "signal-distance=" << _fileSettings.getSignalDistance() << '\n';
+	ssResult << "comment-spaces=" << _fileSettings.getCommentSpaces() << '\n';
+	ssResult << "line-end-comments=" << _fileSettings.isEnableLineEndComments() << '\n';
+	ssResult << "pre-line-comments=" << _fileSettings.isEnablePreLineComments() << '\n';
+	ssResult << "comments-header=" << _fileSettings.getCommentsColumnHeader() << '\n';
+	ssResult << "caption-interval=" << _fileSettings.getSignalCaptionInterval() << '\n';
+	ssResult << "dont-care=" << _fileSettings.getDontCareIdentifier() << '\n';
+	ssResult << "reproducible-header=" << _fileSettings.isEnableReproducibleHeader() << '\n';
+	ssResult << "toggle-coverage=" << _fileSettings.isEnableToggleCoverage() << '\n';
+	ssResult << "dont-care-coverage=" << _fileSettings.isEnableDontCareCoverage() << '\n';
+	ssResult << "time-column=" << _fileSettings.getTimeColumnName() << "," <<
+			_fileSettings.getTimeColumnDigits() << "," <<
+			_fileSettings.isEnableDeltaTime() << '\n';
+
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	for (size_t i = 0; i < sigDecls.size(); ++i) {
+		ssResult << "signal=" << sigDecls[i].GetName() << "," <<
+				sigDecls[i].GetWidth() << "," << sigDecls[i].GetPrintBase() << "," <<
+				sigDecls[i].IsAppendWidthInCaption() << '\n';
+	}
+	return ssResult.str();
+}
+
+/**
+ * @brief Read the description of an entry (without its content hash).
+ * @param _descriptionPath The path of the description file.
+ * @param _contentHash The content hash recorded in the description.
+ * @return The description or an empty string if there is no such entry.
+ */
+string TVFileCache::ReadDescription(const string & _descriptionPath,
+		uint64_t & _contentHash) {
+	ifstream file(_descriptionPath.c_str());
+	stringstream ssResult;
+	string line;
+
+	while (getline(file, line)) {
+		if (line.compare(0, kContentHashPrefix.length(), kContentHashPrefix) == 0) {
+			_contentHash = strtoull(line.c_str() + kContentHashPrefix.length(), NULL,
+					16);
+			return ssResult.str();
+		}
+		ssResult << line << '\n';
+	}
+
+	// A description without content hash is incomplete.
+	return "";
+}
+
+/**
+ * @brief Compute the content hash of a file (as the TVGenerator does while
+ *   writing it).
+ * @param _filePath The path of the file.
+ * @param _contentHash The content hash of the file.
+ * @return True if the file could be read.
+ */
+bool TVFileCache::HashFile(const string & _filePath, uint64_t & _contentHash) {
+	ifstream file(_filePath.c_str(), ios::binary);
+	char chunk[65536];
+
+	// Start with the hash of no data.
+	_contentHash = TVHashBuffer::Hash(string());
+	while (file.read(chunk, sizeof(chunk)) || file.gcount() > 0) {
+		_contentHash = TVHashBuffer::Hash(chunk, file.gcount(), _contentHash);
+	}
+	return file.eof() && !file.bad();
+}
+
+/**
+ * @brief Hard link (if enabled and possible) or copy a file.
+ * @param _sourcePath The path of the existing file.
+ * @param _targetPath The path of the file to be created.
+ * @param _contentHash If not NULL, the content hash of the file is computed
+ *   on the way (while copying or by reading the linked file).
+ * @return True if successfully.
+ */
+bool TVFileCache::LinkOrCopy(const string & _sourcePath,
+		const string & _targetPath, uint64_t * _contentHash) const {
+	if (useHardLinks_ && link(_sourcePath.c_str(), _targetPath.c_str()) == 0) {
+		return _contentHash == NULL || HashFile(_targetPath, *_contentHash);
+	}
+
+	ifstream source(_sourcePath.c_str(), ios::binary);
+	ofstream target(_targetPath.c_str(), ios::binary | ios::trunc);
+	if (!source || !target) {
+		return false;
+	}
+	TVHashBuffer hashBuffer;
+	hashBuffer.Reset(target.rdbuf());
+	ostream hashStream(&hashBuffer);
+	hashStream << source.rdbuf();
+	hashStream.flush();
+	if (_contentHash != NULL) {
+		*_contentHash = hashBuffer.GetHash();
+	}
+	target.close();
+	return hashStream.good() && !target.fail();
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Compute the key of a cache entry.
+ * @param _fileSettings The settings of the test vector file.
+ * @param _fingerprint The fingerprint of the generating model.
+ * @return The key (16 hexadecimal digits).
+ */
+string TVFileCache::ComputeKey(const TVFileSettings & _fileSettings,
+		const string & _fingerprint) {
+	return TVHashBuffer::ToHexString(
+			TVHashBuffer::Hash(Describe(_fileSettings, _fingerprint)));
+}
+
+/**
+ * @brief Serve a test vector file from the cache.
+ *
+ * Any file existing at the target path is removed first, even if the entry
+ * is missing, so a file generated there afterwards never writes through a
+ * hard link into the cache. The content hash of the served file is verified
+ * against the one recorded when storing the entry.
+ *
+ * @param _fileSettings The settings of the test vector file. The file is
+ *   placed at the file path given in the settings.
+ * @param _fingerprint The fingerprint of the generating model.
+ * @return True if the file has been served from the cache, false if it has to
+ *   be generated.
+ */
+bool TVFileCache::Fetch(const TVFileSettings & _fileSettings,
+		const string & _fingerprint) const {
+	const string targetPath = _fileSettings.getFilePath();
+	unlink(targetPath.c_str());
+
+	const string description = Describe(_fileSettings, _fingerprint);
+	const string key = TVHashBuffer::ToHexString(TVHashBuffer::Hash(description));
+	uint64_t expectedHash = 0;
+	if (ReadDescription(GetDescriptionPath(key), expectedHash) != description) {
+		return false;
+	}
+
+	uint64_t contentHash = 0;
+	if (!LinkOrCopy(GetEntryPath(key), targetPath, &contentHash) ||
+			contentHash != expectedHash) {
+		unlink(targetPath.c_str());
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Store a freshly generated test vector file in the cache.
+ *
+ * The description is written last, so an interrupted store never results in
+ * an entry which can be fetched.
+ *
+ * @param _fileSettings The settings of the test vector file. The file is
+ *   taken from the file path given in the settings.
+ * @param _fingerprint The fingerprint of the generating model.
+ * @param _contentHash The content hash of the file as computed by the
+ *   TVGenerator (recorded in the description of the entry).
+ */
+void TVFileCache::Store(const TVFileSettings & _fileSettings,
+		const string & _fingerprint, const uint64_t _contentHash) const {
+	const string description = Describe(_fileSettings, _fingerprint);
+	const string key = TVHashBuffer::ToHexString(TVHashBuffer::Hash(description));
+	const string entryPath = GetEntryPath(key);
+	const string descriptionPath = GetDescriptionPath(key);
+
+	stringstream ssSuffix;
+	ssSuffix << ".tmp" << getpid();
+	const string tmpEntryPath = entryPath + ssSuffix.str();
+	const string tmpDescriptionPath = descriptionPath + ssSuffix.str();
+
+	unlink(tmpEntryPath.c_str());
+	if (!LinkOrCopy(_fileSettings.getFilePath(), tmpEntryPath, NULL) ||
+			rename(tmpEntryPath.c_str(), entryPath.c_str()) != 0) {
+		unlink(tmpEntryPath.c_str());
+		throw runtime_error("Unable to store '" + _fileSettings.getFilePath() +
+				"' in the test vector cache.");
+	}
+
+	ofstream descriptionFile(tmpDescriptionPath.c_str());
+	descriptionFile << description << kContentHashPrefix <<
+			TVHashBuffer::ToHexString(_contentHash) << '\n';
+	descriptionFile.close();
+	if (descriptionFile.fail() ||
+			rename(tmpDescriptionPath.c_str(), descriptionPath.c_str()) != 0) {
+		unlink(tmpDescriptionPath.c_str());
+		throw runtime_error("Unable to store the description of '" +
+				_fileSettings.getFilePath() + "' in the test vector cache.");
+	}
+}
@@ -46,7 +46,10 @@ TVFileSettings::TVFileSettings() :
     commentIndicator_("%"), columnIndicator_("|"), signalDistance_(1),
     commentSpaces_(3), enableLineEndComments_(true), enablePreLineComments_(false),
     commentsColumnHeader_("Comments"), signalCaptionInterval_(50),
-    dontCareIdentifier_('x') {
+    dontCareIdentifier_('x'), enableReproducibleHeader_(false),
+    enableContentHash_(false), enableToggleCoverage_(false),
+    enableDontCareCoverage_(false), timeColumnDigits_(0),
+    enableDeltaTime_(false) {
 }
 
 /**
@@ -62,7 +65,10 @@ TVFileSettings::TVFileSettings(string _filePath, string _author,
     commentIndicator_("%"), columnIndicator_("|"), signalDistance_(1),
     commentSpaces_(3), enableLineEndComments_(true), enablePreLineComments_(false),
     commentsColumnHeader_("Comments"), signalCaptionInterval_(50),
-    dontCareIdentifier_('x'){
+    dontCareIdentifier_('x'), enableReproducibleHeader_(false),
+    enableContentHash_(false), enableToggleCoverage_(false),
+    enableDontCareCoverage_(false), timeColumnDigits_(0),
+    enableDeltaTime_(false) {
 
   filePath_     = _filePath;
   author_       = _author;
@@ -82,7 +88,10 @@ TVFileSettings::TVFileSettings(string _filePath, string _author,
     const string _columnIndicator, const int _commentSpaces) :
     signalDistance_(1), enableLineEndComments_(true), enablePreLineComments_(false),
     commentsColumnHeader_("Comments"), signalCaptionInterval_(50),
-    dontCareIdentifier_('x') {
+    dontCareIdentifier_('x'), enableReproducibleHeader_(false),
+    enableContentHash_(false), enableToggleCoverage_(false),
+    enableDontCareCoverage_(false), timeColumnDigits_(0),
+    enableDeltaTime_(false) {
 
   filePath_         = _filePath;
   author_           = _author;
@@ -0,0 +1,579 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVFileSplitter.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Splits test vector files into shards and merges them again.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "TVFileSplitter.h"
+#include "TVGenerator.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Map a whole file into memory (read-only).
+ * @param _filePath The path of the file to be mapped.
+ */
+TVFileSplitter::MappedFile::MappedFile(const string & _filePath) : data(NULL),
+		size(0) {
+	const int fd = open(_filePath.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw runtime_error("Unable to open test vector file '" + _filePath +
+				"': " + strerror(errno));
+	}
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0) {
+		close(fd);
+		throw runtime_error("Unable to determine the size of test vector file '" +
+				_filePath + "'.");
+	}
+	size = fileStat.st_size;
+	if (size > 0) {
+		void * mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping == MAP_FAILED) {
+			close(fd);
+			throw runtime_error("Unable to map test vector file '" + _filePath +
+					"': " + strerror(errno));
+		}
+		madvise(mapping, size, MADV_SEQUENTIAL);
+		data = static_cast<const char *>(mapping);
+	}
+	close(fd);
+}
+
+/**
+ * @brief Unmap the file.
+ */
+TVFileSplitter::MappedFile::~MappedFile() {
+	if (data != NULL) {
+		munmap(const_cast<char *>(data), size);
+	}
+}
+
+/**
+ * @brief Constructor
+ * @param _fileSettings The settings describing the files read and written (the
+ *   file path is ignored).
+ */
+TVFileSplitter::TVFileSplitter(const TVFileSettings & _fileSettings) :
+		fileSettings_(_fileSettings), threadCount_(1) {
+	const unsigned int cores = thread::hardware_concurrency();
+	threadCount_ = (cores > 0) ? cores : 1;
+}
+
+/**
+ * @brief Destructor
+ */
+TVFileSplitter::~TVFileSplitter() {
+}
+
+
+// ****************************************************************************
+// Getter/Setter
+// ****************************************************************************
+
+/**
+ * @brief Set the number of threads scanning the input and writing the shards.
+ * @param _threadCount The number of threads (at least one).
+ */
+void TVFileSplitter::SetThreadCount(const int _threadCount) {
+	if (_threadCount < 1) {
+		throw invalid_argument("The splitter requires at least one thread.");
+	}
+	threadCount_ = _threadCount;
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Check whether a line (without its line break) is a test vector line.
+ * @param _begin The first character of the line.
+ * @param _end The end of the line.
+ * @return False for empty lines and lines starting with the comment indicator.
+ */
+bool TVFileSplitter::IsVectorLine(const char * _begin, const char * _end) const {
+	while (_begin != _end && (*_begin == ' ' || *_begin == '\t' || *_begin == '\r')) {
+		++_begin;
+	}
+	if (_begin == _end) {
+		return false;
+	}
+	const string & commentIndicator = fileSettings_.getCommentIndicator();
+	return !((size_t)(_end - _begin) >= commentIndicator.length() &&
+			memcmp(_begin, commentIndicator.data(), commentIndicator.length()) == 0);
+}
+
+/**
+ * @brief Divide a file into one piece per thread, every piece starting at the
+ *   beginning of a line.
+ * @param _file The mapped file.
+ * @return The boundaries of the pieces (incl. zero and the file size).
+ */
+vector<size_t> TVFileSplitter::GetPieces(const MappedFile & _file) const {
+	vector<size_t> pieces(1, 0);
+	for (int t = 1; t < threadCount_; ++t) {
+		size_t pos = max(pieces.back(), (size_t)(_file.size / threadCount_ * t));
+		while (pos < _file.size && pos > 0 && _file.data[pos - 1] != '\n') {
+			++pos;
+		}
+		pieces.push_back(pos);
+	}
+	pieces.push_back(_file.size);
+	return pieces;
+}
+
+/**
+ * @brief Count the test vector lines within a piece of a file.
+ * @param _file The mapped file.
+ * @param _begin The offset of the first line of the piece.
+ * @param _end The offset right after the piece.
+ * @return The number of test vector lines.
+ */
+long long TVFileSplitter::CountVectorLines(const MappedFile & _file,
+		const size_t _begin, const size_t _end) const {
+	long long count = 0;
+	size_t pos = _begin;
+	while (pos < _end) {
+		const char * lineEnd = static_cast<const char *>(
+				memchr(_file.data + pos, '\n', _end - pos));
+		const size_t end = (lineEnd != NULL) ? lineEnd - _file.data : _end;
+		if (IsVectorLine(_file.data + pos, _file.data + end)) {
+			++count;
+		}
+		pos = end + 1;
+	}
+	return count;
+}
+
+/**
+ * @brief Find the lines within a piece of a file at which new shards start.
+ * @param _file The mapped file.
+ * @param _begin The offset of the first line of the piece.
+ * @param _end The offset right after the piece.
+ * @param _firstIndex The index of the first test vector within the piece.
+ * @param _vectorsPerShard The number of test vectors per shard.
+ * @param _cuts Receives the offsets of the first lines of new shards.
+ */
+void TVFileSplitter::FindCuts(const MappedFile & _file, const size_t _begin,
+		const size_t _end, long long _firstIndex, const long long _vectorsPerShard,
+		vector<size_t> & _cuts) const {
+	size_t pos = _begin;
+	while (pos < _end) {
+		const char * lineEnd = static_cast<const char *>(
+				memchr(_file.data + pos, '\n', _end - pos));
+		const size_t end = (lineEnd != NULL) ? lineEnd - _file.data : _end;
+		if (IsVectorLine(_file.data + pos, _file.data + end)) {
+			if (_firstIndex > 0 && _firstIndex % _vectorsPerShard == 0) {
+				_cuts.push_back(pos);
+			}
+			++_firstIndex;
+		}
+		pos = end + 1;
+	}
+}
+
+/**
+ * @brief Find the first test vector line at or after the line starting at
+ *   the provided offset.
+ * @param _file The mapped file.
+ * @param _pos The offset of a line.
+ * @return The offset of the test vector line, or the file size if there is
+ *   none.
+ */
+size_t TVFileSplitter::FindVectorLine(const MappedFile & _file, size_t _pos) const {
+	while (_pos < _file.size) {
+		const char * lineEnd = static_cast<const char *>(
+				memchr(_file.data + _pos, '\n', _file.size - _pos));
+		const size_t end = (lineEnd != NULL) ? lineEnd - _file.data : _file.size;
+		if (IsVectorLine(_file.data + _pos, _file.data + end)) {
+			return _pos;
+		}
+		_pos = end + 1;
+	}
+	return _file.size;
+}
+
+/**
+ * @brief Parse the time column at the beginning of a test vector line.
+ * @param _begin The first character of the line.
+ * @param _end The end of the line.
+ * @param _time Receives the value of the time column.
+ * @return The first character following the time column and its separator.
+ */
+const char * TVFileSplitter::ParseTime(const char * _begin, const char * _end,
+		long long & _time) const {
+	while (_begin != _end && (*_begin == ' ' || *_begin == '\t')) {
+		++_begin;
+	}
+	const char * digitsBegin = _begin;
+	_time = 0;
+	while (_begin != _end && *_begin >= '0' && *_begin <= '9') {
+		_time = _time * 10 + (*_begin - '0');
+		++_begin;
+	}
+	if (_begin == digitsBegin || (_begin != _end && *_begin != ' ' &&
+			*_begin != '\t' && *_begin != '\r')) {
+		throw invalid_argument("Test vector line '" + string(digitsBegin, _end) +
+				"' does not start with a valid time.");
+	}
+	while (_begin != _end && (*_begin == ' ' || *_begin == '\t')) {
+		++_begin;
+	}
+	return _begin;
+}
+
+/**
+ * @brief Sum up the values of the time column of the test vector lines within
+ *   a range of a file (i.e., the time passing within a delta encoded range).
+ * @param _file The mapped file.
+ * @param _begin The offset of the first line.
+ * @param _end The offset right after the last line.
+ * @return The sum of the time column values.
+ */
+long long TVFileSplitter::SumTimes(const MappedFile & _file, const size_t _begin,
+		const size_t _end) const {
+	long long sum = 0;
+	size_t pos = _begin;
+	while (pos < _end) {
+		const char * lineEnd = static_cast<const char *>(
+				memchr(_file.data + pos, '\n', _end - pos));
+		const size_t end = (lineEnd != NULL) ? lineEnd - _file.data : _end;
+		if (IsVectorLine(_file.data + pos, _file.data + end)) {
+			long long time;
+			ParseTime(_file.data + pos, _file.data + end, time);
+			sum += time;
+		}
+		pos = end + 1;
+	}
+	return sum;
+}
+
+/**
+ * @brief Run a task for every shard, distributing the shards among the
+ *   threads.
+ * @param _shardCount The number of shards.
+ * @param _task The task, called with the index of a shard. The first error
+ *   thrown is rethrown after all threads have finished.
+ */
+void TVFileSplitter::RunOnShards(const size_t _shardCount,
+		const function<void(size_t)> & _task) const {
+	atomic<size_t> nextShard(0);
+	vector<exception_ptr> errors(threadCount_);
+	vector<thread> workers;
+	for (int t = 0; t < threadCount_; ++t) {
+		workers.push_back(thread([&_task, &nextShard, &errors, _shardCount, t]() {
+			try {
+				for (size_t i = nextShard++; i < _shardCount; i = nextShard++) {
+					_task(i);
+				}
+			} catch (...) {
+				errors[t] = current_exception();
+			}
+		}));
+	}
+	for (size_t w = 0; w < workers.size(); ++w) {
+		workers[w].join();
+	}
+	for (int t = 0; t < threadCount_; ++t) {
+		if (errors[t]) {
+			rethrow_exception(errors[t]);
+		}
+	}
+}
+
+/**
+ * @brief Write the shards of a file in parallel.
+ * @param _file The mapped file.
+ * @param _cuts The offsets of the first lines of the shards (except the first
+ *   shard), in ascending order.
+ * @param _outputPrefix The prefix of the shard paths (see GetShardPath()).
+ * @return The paths of the shards written.
+ */
+vector<string> TVFileSplitter::WriteShards(const MappedFile & _file,
+		const vector<size_t> & _cuts, const string & _outputPrefix) const {
+	const size_t shardCount = _cuts.size() + 1;
+	vector<string> paths(shardCount);
+	vector<size_t> bounds(1, 0);
+	for (size_t i = 0; i < shardCount; ++i) {
+		paths[i] = GetShardPath(_outputPrefix, i);
+		bounds.push_back((i == shardCount - 1) ? _file.size : _cuts[i]);
+	}
+
+	// With delta encoding, every shard continues from the time passed in all
+	// shards before it.
+	vector<long long> timeSums(shardCount, 0);
+	if (fileSettings_.isEnableTimeColumn() && fileSettings_.isEnableDeltaTime()) {
+		vector<long long> shardTimes(shardCount);
+		RunOnShards(shardCount, [this, &_file, &bounds, &shardTimes](size_t i) {
+			shardTimes[i] = SumTimes(_file, bounds[i], bounds[i + 1]);
+		});
+		for (size_t i = 1; i < shardCount; ++i) {
+			timeSums[i] = timeSums[i - 1] + shardTimes[i - 1];
+		}
+	}
+
+	RunOnShards(shardCount, [this, &_file, &bounds, &paths, &timeSums](size_t i) {
+		TVFileSettings shardSettings = fileSettings_;
+		shardSettings.setFilePath(paths[i]);
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(shardSettings);
+		CopyVectorLines(_file, bounds[i], bounds[i + 1], timeSums[i], tvGenerator);
+		tvGenerator.Finalize();
+	});
+	return paths;
+}
+
+/**
+ * @brief Copy the test vector lines within a range of a file to a generator.
+ * @param _file The mapped file.
+ * @param _begin The offset of the first line.
+ * @param _end The offset right after the last line.
+ * @param _timeSum The sum of the time column values preceding the range (i.e.,
+ *   the absolute time of the previous test vector for delta encoded files),
+ *   updated by the range.
+ * @param _tvGenerator The (single file based) TVGenerator to write to.
+ * @return The number of test vector lines copied.
+ */
+long long TVFileSplitter::CopyVectorLines(const MappedFile & _file,
+		const size_t _begin, const size_t _end, long long & _timeSum,
+		TVGenerator & _tvGenerator) const {
+	const bool isTimeColumn = fileSettings_.isEnableTimeColumn();
+	long long count = 0;
+	size_t pos = _begin;
+	while (pos < _end) {
+		const char * lineEnd = static_cast<const char *>(
+				memchr(_file.data + pos, '\n', _end - pos));
+		const size_t end = (lineEnd != NULL) ? lineEnd - _file.data : _end;
+		if (IsVectorLine(_file.data + pos, _file.data + end)) {
+			const char * values = _file.data + pos;
+			long long time = -1;
+			if (isTimeColumn) {
+				values = ParseTime(values, _file.data + end, time);
+				_timeSum += time;
+				if (fileSettings_.isEnableDeltaTime()) {
+					time = _timeSum;
+				}
+			}
+			_tvGenerator.WriteFormattedTestVectorLine(
+					TVStringView(values, _file.data + end - values), time,
+					TVStringView());
+			++count;
+		}
+		pos = end + 1;
+	}
+	return count;
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Get the path of a shard.
+ * @param _outputPrefix The prefix of the shard paths.
+ * @param _index The index of the shard.
+ * @return The prefix followed by the four-digit index and ".tv".
+ */
+string TVFileSplitter::GetShardPath(const string & _outputPrefix,
+		const size_t _index) {
+	stringstream ssPath;
+	ssPath << _outputPrefix << setw(4) << setfill('0') << _index << ".tv";
+	return ssPath.str();
+}
+
+/**
+ * @brief Count the test vectors of a file (scanning it on multiple threads).
+ * @param _inputPath The path of the test vector file.
+ * @return The number of test vector lines.
+ */
+long long TVFileSplitter::CountVectors(const string & _inputPath) const {
+	const MappedFile file(_inputPath);
+	const vector<size_t> pieces = GetPieces(file);
+	vector<long long> counts(threadCount_, 0);
+
+	vector<thread> workers;
+	for (int t = 1; t < threadCount_; ++t) {
+		workers.push_back(thread([this, &file, &pieces, &counts, t]() {
+			counts[t] = CountVectorLines(file, pieces[t], pieces[t + 1]);
+		}));
+	}
+	counts[0] = CountVectorLines(file, pieces[0], pieces[1]);
+	for (size_t w = 0; w < workers.size(); ++w) {
+		workers[w].join();
+	}
+
+	long long count = 0;
+	for (int t = 0; t < threadCount_; ++t) {
+		count += counts[t];
+	}
+	return count;
+}
+
+/**
+ * @brief Split a test vector file into shards of equal test vector counts.
+ *
+ * The input is scanned twice on multiple threads: first to count the test
+ * vectors of every piece, then to locate the shard boundaries within every
+ * piece. The last shard holds the remaining test vectors.
+ *
+ * @param _inputPath The path of the test vector file to be split.
+ * @param _outputPrefix The prefix of the shard paths (see GetShardPath()).
+ * @param _vectorsPerShard The number of test vectors per shard.
+ * @return The paths of the shards written.
+ */
+vector<string> TVFileSplitter::SplitByVectorCount(const string & _inputPath,
+		const string & _outputPrefix, const long long _vectorsPerShard) const {
+	if (_vectorsPerShard < 1) {
+		throw invalid_argument("A shard must hold at least one test vector.");
+	}
+	const MappedFile file(_inputPath);
+	const vector<size_t> pieces = GetPieces(file);
+
+	// Count the test vectors of every piece.
+	vector<long long> counts(threadCount_, 0);
+	vector<thread> workers;
+	for (int t = 1; t < threadCount_; ++t) {
+		workers.push_back(thread([this, &file, &pieces, &counts, t]() {
+			counts[t] = CountVectorLines(file, pieces[t], pieces[t + 1]);
+		}));
+	}
+	counts[0] = CountVectorLines(file, pieces[0], pieces[1]);
+	for (size_t w = 0; w < workers.size(); ++w) {
+		workers[w].join();
+	}
+
+	// Locate the shard boundaries within every piece.
+	vector<long long> firstIndices(threadCount_, 0);
+	for (int t = 1; t < threadCount_; ++t) {
+		firstIndices[t] = firstIndices[t - 1] + counts[t - 1];
+	}
+	vector<vector<size_t> > pieceCuts(threadCount_);
+	workers.clear();
+	for (int t = 1; t < threadCount_; ++t) {
+		workers.push_back(thread([this, &file, &pieces, &firstIndices, &pieceCuts,
+				_vectorsPerShard, t]() {
+			FindCuts(file, pieces[t], pieces[t + 1], firstIndices[t],
+					_vectorsPerShard, pieceCuts[t]);
+		}));
+	}
+	FindCuts(file, pieces[0], pieces[1], firstIndices[0], _vectorsPerShard,
+			pieceCuts[0]);
+	for (size_t w = 0; w < workers.size(); ++w) {
+		workers[w].join();
+	}
+
+	vector<size_t> cuts;
+	for (int t = 0; t < threadCount_; ++t) {
+		cuts.insert(cuts.end(), pieceCuts[t].begin(), pieceCuts[t].end());
+	}
+	return WriteShards(file, cuts, _outputPrefix);
+}
+
+/**
+ * @brief Split a test vector file into shards of about the same size.
+ *
+ * Every shard starts at the first test vector line following the given
+ * number of bytes of the input (counted from the start of the shard), hence,
+ * the shards written are roughly of the given size.
+ *
+ * @param _inputPath The path of the test vector file to be split.
+ * @param _outputPrefix The prefix of the shard paths (see GetShardPath()).
+ * @param _bytesPerShard The number of input bytes per shard.
+ * @return The paths of the shards written.
+ */
+vector<string> TVFileSplitter::SplitBySize(const string & _inputPath,
+		const string & _outputPrefix, const long long _bytesPerShard) const {
+	if (_bytesPerShard < 1) {
+		throw invalid_argument("A shard must hold at least one byte.");
+	}
+	const MappedFile file(_inputPath);
+
+	vector<size_t> cuts;
+	size_t pos = FindVectorLine(file, 0) + _bytesPerShard;
+	while (pos < file.size) {
+		while (pos < file.size && file.data[pos - 1] != '\n') {
+			++pos;
+		}
+		pos = FindVectorLine(file, pos);
+		if (pos >= file.size) {
+			break;
+		}
+		cuts.push_back(pos);
+		pos += _bytesPerShard;
+	}
+	return WriteShards(file, cuts, _outputPrefix);
+}
+
+/**
+ * @brief Concatenate the test vectors of several files into a single file.
+ *
+ * The files are appended in the given order. The merged file gets a single
+ * header and its signal captions at the configured interval.
+ * With a time column, the times of every file are absolute times (each file
+ * starting from its own first test vector), which must not decrease across
+ * the files (e.g., the shards of a single file).
+ *
+ * @param _inputPaths The paths of the test vector files to be merged.
+ * @param _outputPath The path of the merged test vector file.
+ * @return The number of test vectors written.
+ */
+long long TVFileSplitter::Merge(const vector<string> & _inputPaths,
+		const string & _outputPath) const {
+	TVFileSettings mergedSettings = fileSettings_;
+	mergedSettings.setFilePath(_outputPath);
+	TVGenerator tvGenerator;
+	tvGenerator.Initialize(mergedSettings);
+
+	long long count = 0;
+	for (size_t i = 0; i < _inputPaths.size(); ++i) {
+		const MappedFile file(_inputPaths[i]);
+		long long timeSum = 0;
+		count += CopyVectorLines(file, 0, file.size, timeSum, tvGenerator);
+	}
+	tvGenerator.Finalize();
+	return count;
+}
@@ -37,14 +37,79 @@
 #include <sstream>
 #include <fstream>
 #include <exception>
+#include <map>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <utility>
 #include <time.h>
 #include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
 
 #include "TVGenerator.h"
 #include "StdLogicVector.h"
 
 using namespace std;
 
+/**
+ * @brief Write a character repeatedly (used for padding and don't care values,
+ *   without creating a temporary string per line).
+ * @param _os The stream to write to.
+ * @param _c The character to be written.
+ * @param _count The number of characters to be written.
+ */
+static void WriteRepeated(ostream & _os, const char _c, size_t _count) {
+	char chunk[64];
+	memset(chunk, _c, min(_count, sizeof(chunk)));
+	while (_count > 0) {
+		const size_t length = min(_count, sizeof(chunk));
+		_os.write(chunk, length);
+		_count -= length;
+	}
+}
+
+/**
+ * @brief Write the value of the time column, padded with leading zeros.
+ * @param _os The stream to write to.
+ * @param _time The (non-negative) value to be written.
+ * @param _digits The minimum number of digits to be written.
+ */
+static void WriteTime(ostream & _os, long long _time, const int _digits) {
+	char digits[24];
+	size_t length = 0;
+	do {
+		digits[sizeof(digits) - ++length] = (char)('0' + _time % 10);
+		_time /= 10;
+	} while (_time > 0);
+	if ((int)length < _digits) {
+		WriteRepeated(_os, '0', _digits - length);
+	}
+	_os.write(digits + sizeof(digits) - length, length);
+}
+
+/**
+ * @brief Get the next whitespace separated token of a formatted line.
+ * @param _pos The position to continue at (advanced behind the token).
+ * @param _end The end of the line.
+ * @param _token The token found.
+ * @return False if there are no more tokens.
+ */
+static bool NextToken(const char * & _pos, const char * const _end,
+		TVStringView & _token) {
+	while (_pos != _end && (*_pos == ' ' || *_pos == '\t')) {
+		_pos++;
+	}
+	const char * const begin = _pos;
+	while (_pos != _end && *_pos != ' ' && *_pos != '\t') {
+		_pos++;
+	}
+	_token = TVStringView(begin, _pos - begin);
+	return _pos != begin;
+}
+
 // ****************************************************************************
 // Constructors/Destructors
 // ****************************************************************************
@@ -54,13 +119,84 @@ using namespace std;
  *   single file for both stimuli and expected responses.
  */
 TVGenerator::TVGenerator() : isSingleFileBased_(true), testVectorCount_(0),
-		stimuliCount_(0), expRspCount_(0){
+		stimuliCount_(0), expRspCount_(0), ownsStreams_(false),
+		tvStream_(&tvFile_), stimStream_(&stimFile_), expRspStream_(&expRspFile_),
+		tvHashStream_(NULL), stimHashStream_(NULL), expRspHashStream_(NULL),
+		checkpointInterval_(0), headerTime_(0), vectorBufferSize_(0),
+		commentBufferSize_(0), isBackgroundFormatting_(false),
+		validationPolicy_(kValidateDefault), tvTime_(-1), stimTime_(-1),
+		expRspTime_(-1), isLowFootprint_(false), fileBufferSize_(65536) {
+	memset(writeLatencyHistogram_, 0, sizeof(writeLatencyHistogram_));
 }
 
 /**
  * @brief Destructor
+ *
+ * If Finalize() has not been called, the test vectors still held by the
+ * vector buffers are written to the files opened by the TVGenerator itself
+ * (as they would have been without buffering). Streams handed over by the
+ * caller might already be gone, hence, their buffered test vectors are
+ * discarded.
  */
 TVGenerator::~TVGenerator() {
+	// The worker threads of the vector buffers must not outlive the streams and
+	// settings they write with (errors can no longer be reported here).
+	if (ownsStreams_) {
+		try {
+			FlushVectorBuffers();
+		} catch (...) {
+		}
+	}
+	TVVectorBuffer * vectorBuffers[] = { &tvVectorBuffer_, &stimVectorBuffer_,
+			&expRspVectorBuffer_ };
+	for (TVVectorBuffer * vectorBuffer : vectorBuffers) {
+		try {
+			vectorBuffer->Wait();
+		} catch (...) {
+		}
+	}
+
+	// Files which have not been finalized are flushed and closed here, since
+	// their buffers are destroyed before the file streams themselves.
+	if (tvFile_.is_open()) {
+		tvStream_->flush();
+		tvFile_.close();
+	}
+	if (stimFile_.is_open()) {
+		stimStream_->flush();
+		stimFile_.close();
+	}
+	if (expRspFile_.is_open()) {
+		expRspStream_->flush();
+		expRspFile_.close();
+	}
+}
+
+/**
+ * @brief Start timing a write call.
+ * @param _tvGenerator The TVGenerator whose histogram should be updated.
+ */
+TVGenerator::WriteTimer::WriteTimer(TVGenerator & _tvGenerator) :
+		tvGenerator_(_tvGenerator) {
+	if (tvGenerator_.isLowFootprint_) {
+		clock_gettime(CLOCK_MONOTONIC, &start_);
+	}
+}
+
+/**
+ * @brief Stop timing the write call and count it in the histogram.
+ */
+TVGenerator::WriteTimer::~WriteTimer() {
+	if (!tvGenerator_.isLowFootprint_) {
+		return;
+	}
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	const long long latency = (long long)(end.tv_sec - start_.tv_sec) * 1000000000 +
+			(end.tv_nsec - start_.tv_nsec);
+	const int bucket = (latency <= 0) ? 0 :
+			min(63 - __builtin_clzll(latency), kWriteLatencyBucketCount - 1);
+	tvGenerator_.writeLatencyHistogram_[bucket]++;
 }
 
 
@@ -78,11 +214,11 @@ TVGenerator::~TVGenerator() {
 void TVGenerator::WriteTVFileHeader() {
   if (isSingleFileBased_) {
     // Write header to combined test vector file.
-  	WriteTVFileHeader(tvFile_, tvFileSettings_);
+  	WriteTVFileHeader(*tvStream_, tvFileSettings_);
   } else {
   	// Write header to both separate stimuli and expected responses file.
-  	WriteTVFileHeader(stimFile_, stimFileSettings_);
-  	WriteTVFileHeader(expRspFile_, expRspFileSettings_);
+  	WriteTVFileHeader(*stimStream_, stimFileSettings_);
+  	WriteTVFileHeader(*expRspStream_, expRspFileSettings_);
   }
 }
 /**
@@ -90,21 +226,77 @@ void TVGenerator::WriteTVFileHeader() {
  * @param _fileSettings The test vector file settings to which the header
  *   should be written.
  */
-void TVGenerator::WriteTVFileHeader(ofstream & _tvFile, TVFileSettings & _tvFileSettings) {
+void TVGenerator::WriteTVFileHeader(ostream & _tvFile, TVFileSettings & _tvFileSettings) {
+
+  // Get current time (only formatted again once it has changed, which saves
+  // the time conversion when many small files are written in a row).
+  const time_t now = time(0);
+  if (now != headerTime_) {
+    headerTime_       = now;
+    headerTimeString_ = FormatHeaderTime(now);
+    tvHeader_.clear();
+    stimHeader_.clear();
+    expRspHeader_.clear();
+  }
+
+  // Only the file path differs between the files written by Restart(), hence,
+  // the remaining entries are rendered once.
+  string & header = (&_tvFileSettings == &stimFileSettings_) ? stimHeader_ :
+      (&_tvFileSettings == &expRspFileSettings_) ? expRspHeader_ : tvHeader_;
+  if (header.empty()) {
+    header = RenderTVFileHeader(_tvFileSettings, headerTimeString_, false);
+  }
+  if (!_tvFileSettings.isEnableReproducibleHeader()) {
+    WriteTVFileHeaderEntry(_tvFile, _tvFileSettings, "File:",
+        _tvFileSettings.getFilePath());
+  }
+  _tvFile << header;
+  WriteSignalCaptions(_tvFile, _tvFileSettings);
+}
 
-  // Get current time.
-  time_t now = time(0);
+/**
+ * @brief Format the creation time as it should appear in the file header.
+ * @param _time The creation time.
+ * @return The formatted time.
+ */
+string TVGenerator::FormatHeaderTime(const time_t _time) {
   struct tm tstruct;
   char buf[80];
-  tstruct = *localtime(&now);
+  localtime_r(&_time, &tstruct);
   strftime(buf, sizeof(buf), "%Y-%m-%d, %X", &tstruct);
+  return buf;
+}
 
-  WriteTVFileHeaderEntry(_tvFile, _tvFileSettings, "File:", _tvFileSettings.getFilePath());
-  WriteTVFileHeaderEntry(_tvFile, _tvFileSettings, "Author:", _tvFileSettings.getAuthor());
-  WriteTVFileHeaderEntry(_tvFile, _tvFileSettings, "Project:", _tvFileSettings.getProjectName());
-  WriteTVFileHeaderEntry(_tvFile, _tvFileSettings, "Created:", buf);
-  WriteTVFileHeaderEntry(_tvFile, _tvFileSettings, "Content:", _tvFileSettings.getContent());
-  WriteSignalCaptions(_tvFile, _tvFileSettings);
+/**
+ * @brief Render the entries of the file header (i.e., without the signal
+ *   captions).
+ * @param _tvFileSettings The corresponding test vector file settings.
+ * @param _timeString The formatted creation time (see FormatHeaderTime()).
+ * @param _isWithFilePath Whether the entry of the file path is included.
+ * @return The file header entries (incl. the final line break).
+ */
+string TVGenerator::RenderTVFileHeader(const TVFileSettings & _tvFileSettings,
+    const string & _timeString, const bool _isWithFilePath) {
+  stringstream ssResult;
+
+  // A reproducible header omits the entries differing between two runs
+  // generating the same content.
+  const bool isReproducible = _tvFileSettings.isEnableReproducibleHeader();
+  if (!isReproducible && _isWithFilePath) {
+    WriteTVFileHeaderEntry(ssResult, _tvFileSettings, "File:", _tvFileSettings.getFilePath());
+  }
+  WriteTVFileHeaderEntry(ssResult, _tvFileSettings, "Author:", _tvFileSettings.getAuthor());
+  WriteTVFileHeaderEntry(ssResult, _tvFileSettings, "Project:", _tvFileSettings.getProjectName());
+  if (!isReproducible) {
+    WriteTVFileHeaderEntry(ssResult, _tvFileSettings, "Created:", _timeString);
+  }
+  WriteTVFileHeaderEntry(ssResult, _tvFileSettings, "Content:", _tvFileSettings.getContent());
+  if (_tvFileSettings.isEnableTimeColumn()) {
+    WriteTVFileHeaderEntry(ssResult, _tvFileSettings, "Time:",
+        _tvFileSettings.getTimeColumnName() + (_tvFileSettings.isEnableDeltaTime() ?
+        " (delta to the previous test vector)" : " (absolute)"));
+  }
+  return ssResult.str();
 }
 
 /**
@@ -112,11 +304,12 @@ void TVGenerator::WriteTVFileHeader(ofstream & _tvFile, TVFileSettings & _tvFile
  * @param _prefix The prefix to be used for the file header line.
  * @param _entry The actual value of the file header line.
  */
-void TVGenerator::WriteTVFileHeaderEntry(ofstream & _tvFile, TVFileSettings & _fileSettings,
-		string _prefix, string _entry) {
+void TVGenerator::WriteTVFileHeaderEntry(ostream & _tvFile,
+		const TVFileSettings & _fileSettings, const string & _prefix,
+		const string & _entry) {
   const int prefixWidth = 10;
   _tvFile << _fileSettings.getCommentIndicator() << " " << _prefix <<
-      string(prefixWidth - _prefix.length(), ' ') << _entry << endl;
+      string(prefixWidth - _prefix.length(), ' ') << _entry << '\n';
 }
 
 /**
@@ -126,19 +319,201 @@ void TVGenerator::WriteTVFileHeaderEntry(ofstream & _tvFile, TVFileSettings & _f
  * @param _fileSettings The corresponding settings of the test vector file.
  * @param _signalValues The values of the signals to be written to the test
  *   vector file.
+ * @param _time The time of the test vector (see ResolveTime()).
  * @param _comment The comment which should be attached to the end of the test
  *   vector file entry.
  * @return 0 if successfully, otherwise an exception will be thrown.
  */
-int TVGenerator::WriteTVLine(ofstream & _tvFile, TVFileSettings & _fileSettings,
-		vector<StdLogicVector> _signalValues, string _comment, int & _tvCount) {
+int TVGenerator::WriteTVLine(ostream & _tvFile, TVFileSettings & _fileSettings,
+		vector<StdLogicVector> & _signalValues, const long long _time,
+		const TVStringView & _comment, int & _tvCount) {
+
+	ValidateSignalValues(_signalValues, _fileSettings);
+	const long long time = ResolveTime(_fileSettings, _time);
+	const long long timeValue = _fileSettings.isEnableTimeColumn() ?
+			EncodeTime(_fileSettings, time) : 0;
 
-	// Check whether number of provided signal values matches the number of
-	// signal declarations set up during the initialization.
-	if (_signalValues.size() != _fileSettings.getTVDeclarations().size()) {
+	TVVectorBuffer & vectorBuffer = GetVectorBuffer(_fileSettings);
+	if (vectorBuffer.IsEnabled()) {
+		CheckBufferedComment(_comment);
+		if (!vectorBuffer.CanAppend(_comment)) {
+			vectorBuffer.Dispatch(_tvCount);
+		}
+		vectorBuffer.Append(_signalValues, timeValue, _comment);
+		_tvCount++;
+		if (vectorBuffer.IsFull()) {
+			vectorBuffer.Dispatch(_tvCount);
+		}
+	} else {
+		FormatTVLine(_tvFile, _fileSettings, _signalValues, timeValue, _comment,
+				_tvCount);
+		_tvFile << '\n';
+		_tvCount++;
+	}
+	MaybeWriteCheckpoint();
+
+	return 0;
+}
+
+/**
+ * @brief Validate the provided signal values against the signal declarations
+ *   according to the validation policy.
+ *
+ * The number of values is checked in any case (indexing the declarations and
+ * buffers relies on it). The strict policy additionally renders every value
+ * (see RenderSignalValues()) and checks its number of digits against the width of its declaration (for
+ * power-of-two bases exactly, for any other base as an upper bound) and that
+ * all of its digits are valid in the print base.
+ *
+ * @param _signalValues The values of the signals to be checked.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ */
+void TVGenerator::ValidateSignalValues(vector<StdLogicVector> & _signalValues,
+		const TVFileSettings & _fileSettings) {
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	if (_signalValues.size() != sigDecls.size()) {
 		throw invalid_argument("Number of signal values does not match number of "
 				"determined signals during the signal declaration.");
 	}
+	if (validationPolicy_ != kValidateStrict) {
+		return;
+	}
+
+	const vector<string> & rendered = RenderSignalValues(_signalValues,
+			_fileSettings);
+	for (size_t sig = 0; sig < _signalValues.size(); ++sig) {
+		const int printBase = sigDecls[sig].GetPrintBase();
+		const size_t widthDigits = sigDecls[sig].GetDigitCount();
+		const bool isPowerOfTwo = (printBase & (printBase - 1)) == 0;
+		const string & digits = rendered[sig];
+
+		if (isPowerOfTwo ? digits.length() != widthDigits :
+				digits.length() > widthDigits) {
+			throw invalid_argument("Value of signal '" + sigDecls[sig].GetName() +
+					"' has " + to_string(digits.length()) + " digits in base " +
+					to_string(printBase) + ", but its declared width of " +
+					to_string(sigDecls[sig].GetWidth()) + " bits requires " +
+					to_string(widthDigits) + ".");
+		}
+		if (_signalValues[sig].isDontCare()) {
+			continue;
+		}
+		for (size_t i = 0; i < digits.length(); ++i) {
+			const int digit = SignalDeclaration::DigitValue(digits[i]);
+			if (digit < 0 || digit >= printBase) {
+				throw invalid_argument("Value '" + digits + "' of signal '" +
+						sigDecls[sig].GetName() + "' is not valid in base " +
+						to_string(printBase) + ".");
+			}
+		}
+	}
+}
+
+/**
+ * @brief Render the provided values in the print bases of their signals into
+ *   the rendered values of the file (see GetRenderedValues()).
+ *
+ * The rendered values are copied into slots reserved for the digits of every
+ * signal, i.e., no memory is allocated besides the string returned by
+ * StdLogicVector::ToString() itself (which allocates for values exceeding the
+ * small string buffer, i.e., typically 15 digits).
+ *
+ * @param _signalValues The values of the signals to be rendered.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @return The rendered values.
+ */
+const vector<string> & TVGenerator::RenderSignalValues(
+		vector<StdLogicVector> & _signalValues, const TVFileSettings & _fileSettings) {
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	vector<string> & rendered = GetRenderedValues(_fileSettings);
+	for (size_t sig = 0; sig < _signalValues.size(); ++sig) {
+		const string digits = _signalValues[sig].ToString(
+				sigDecls[sig].GetPrintBase(), true);
+		rendered[sig].assign(digits);
+	}
+	return rendered;
+}
+
+/**
+ * @brief Get the most recently rendered values of a test vector file (one slot
+ *   per signal, reserved when the file is opened).
+ * @param _fileSettings One of the TVGenerator's test vector file settings.
+ * @return The rendered values of the corresponding test vector file.
+ */
+vector<string> & TVGenerator::GetRenderedValues(
+		const TVFileSettings & _fileSettings) {
+	return (&_fileSettings == &stimFileSettings_) ? stimRenderedValues_ :
+			(&_fileSettings == &expRspFileSettings_) ? expRspRenderedValues_ :
+			tvRenderedValues_;
+}
+
+/**
+ * @brief Release the settings of the files not used by the current mode (i.e.,
+ *   the stimuli and expected responses settings in single-file mode and vice
+ *   versa).
+ *
+ * The TVGenerator keeps its own copy of the settings of every open file, as
+ * the caller's settings may be changed or destroyed after initialization and
+ * Restart() changes the file paths. Only the settings of the files actually
+ * written are kept, however.
+ */
+void TVGenerator::ReleaseUnusedFileSettings() {
+	if (isSingleFileBased_) {
+		stimFileSettings_		= TVFileSettings();
+		expRspFileSettings_	= TVFileSettings();
+	} else {
+		tvFileSettings_ = TVFileSettings();
+	}
+}
+
+/**
+ * @brief Validate the signal declarations and the layout of a test vector file
+ *   once at initialization.
+ * @param _fileSettings The settings of the test vector file.
+ */
+void TVGenerator::ValidateLayout(const TVFileSettings & _fileSettings) {
+	if (_fileSettings.getSignalCaptionInterval() < 1) {
+		throw invalid_argument("The signal caption interval of test vector file '" +
+				_fileSettings.getFilePath() + "' must be positive.");
+	}
+	if (_fileSettings.isEnableTimeColumn() && _fileSettings.getTimeColumnDigits() < 1) {
+		throw invalid_argument("The time column of test vector file '" +
+				_fileSettings.getFilePath() + "' must be at least one digit wide.");
+	}
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	for (size_t sig = 0; sig < sigDecls.size(); ++sig) {
+		if (sigDecls[sig].GetWidth() < 1) {
+			throw invalid_argument("Signal '" + sigDecls[sig].GetName() +
+					"' must be at least one bit wide.");
+		}
+		if (sigDecls[sig].GetPrintBase() < 2 || sigDecls[sig].GetPrintBase() > 36) {
+			throw invalid_argument("Signal '" + sigDecls[sig].GetName() +
+					"' has an unsupported print base of " +
+					to_string(sigDecls[sig].GetPrintBase()) + ".");
+		}
+	}
+}
+
+/**
+ * @brief Formats a single test vector line (without the line break) into the
+ *   provided stream.
+ *
+ * If the signal caption is due according to the caption interval of the file
+ * settings, it is written in front of the actual test vector line. The values
+ * are expected to have been checked against the signal declarations already
+ * (see ValidateSignalValues()).
+ *
+ * @param _tvFile The stream to which the line should be written.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _signalValues The values of the signals to be written.
+ * @param _timeValue The value of the time column (if enabled), as it should be
+ *   written (see EncodeTime()).
+ * @param _comment The comment to be attached to the end of the line.
+ * @param _tvCount The number of test vectors written so far to the file.
+ */
+void TVGenerator::FormatTVLine(ostream & _tvFile, TVFileSettings & _fileSettings,
+		vector<StdLogicVector> & _signalValues, const long long _timeValue,
+		const TVStringView & _comment, const int _tvCount) {
 
 	// Check whether signal caption should be repeated before writing the actual
 	// test vector entry.
@@ -146,31 +521,66 @@ int TVGenerator::WriteTVLine(ofstream & _tvFile, TVFileSettings & _fileSettings,
 		WriteSignalCaptions(_tvFile, _fileSettings);
 	}
 
+	if (_fileSettings.isEnableTimeColumn()) {
+		WriteTime(_tvFile, _timeValue, _fileSettings.getTimeColumnDigits());
+		_tvFile << " ";
+	}
+
+	TVToggleCoverage * coverage = _fileSettings.isEnableToggleCoverage() ?
+			&GetToggleCoverage(_fileSettings) : NULL;
+
+	// The strict validation has rendered the values already.
+	const vector<string> & rendered = (validationPolicy_ == kValidateStrict) ?
+			GetRenderedValues(_fileSettings) :
+			RenderSignalValues(_signalValues, _fileSettings);
+
 	for (size_t sig = 0; sig < _signalValues.size(); ++sig) {
 
-		string baseString = _signalValues[sig].ToString(
-				_fileSettings.getTVDeclarations()[sig].GetPrintBase(), true);
+		const string & baseString = rendered[sig];
+		const bool isDontCare = _signalValues[sig].isDontCare();
 
 		// If the current signal is set to "don't care", print the respective don't
 		// care characters into the test vector file. Otherwise print the actual
 		// value.
-		_tvFile << (_signalValues[sig].isDontCare() ?
-				string(baseString.length(), _fileSettings.getDontCareIdentifier()) : baseString);
+		if (isDontCare) {
+			WriteRepeated(_tvFile, _fileSettings.getDontCareIdentifier(),
+					baseString.length());
+		} else {
+			_tvFile << baseString;
+		}
 
 		if (sig != _signalValues.size() - 1) {
 			_tvFile << " ";
-		} else {
-			if (_fileSettings.isEnableLineEndComments() && !_comment.empty()) {
-				_tvFile << string(_fileSettings.getCommentSpaces(), ' ') <<
-						_fileSettings.getCommentIndicator() << " " << _comment;
+		}
+
+		// Account for the value in the toggle coverage (based on the digits already
+		// rendered for the file).
+		if (coverage != NULL) {
+			if (isDontCare) {
+				coverage->UpdateDontCare(sig);
+			} else {
+				coverage->Update(sig, baseString);
 			}
-			_tvFile << endl;
 		}
 	}
+	if (coverage != NULL) {
+		coverage->NextVector();
+	}
+	WriteLineEndComment(_tvFile, _fileSettings, _comment);
+}
 
-	_tvCount++;
-
-	return 0;
+/**
+ * @brief Write the line-end comment (if enabled and not empty).
+ * @param _tvFile The stream to which the comment should be written.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _comment The comment to be attached to the end of the line.
+ */
+void TVGenerator::WriteLineEndComment(ostream & _tvFile,
+		const TVFileSettings & _fileSettings, const TVStringView & _comment) {
+	if (_fileSettings.isEnableLineEndComments() && !_comment.empty()) {
+		WriteRepeated(_tvFile, ' ', _fileSettings.getCommentSpaces());
+		_tvFile << _fileSettings.getCommentIndicator() << " " << _comment;
+	}
 }
 
 /**
@@ -181,16 +591,13 @@ int TVGenerator::WriteTVLine(ofstream & _tvFile, TVFileSettings & _fileSettings,
  * @param _line The file to be written to the test vector file.
  * @param _comment The comment to be attached to the end of the line.
  */
-void TVGenerator::WriteArbitraryTVLine(ofstream & _tvFile,
-		TVFileSettings & _tvFileSettings, string _line, string _comment) {
+void TVGenerator::WriteArbitraryTVLine(ostream & _tvFile,
+		TVFileSettings & _tvFileSettings, const TVStringView & _line,
+		const TVStringView & _comment) {
+	FlushVectorBuffers();
 	_tvFile << _line;
-
-	if (tvFileSettings_.isEnableLineEndComments() && !_comment.empty()) {
-		_tvFile << string(tvFileSettings_.getCommentSpaces(), ' ') <<
-				tvFileSettings_.getCommentIndicator() << " " << _comment;
-	}
-
-	_tvFile << endl;
+	WriteLineEndComment(_tvFile, _tvFileSettings, _comment);
+	_tvFile << '\n';
 }
 
 /**
@@ -200,53 +607,102 @@ void TVGenerator::WriteArbitraryTVLine(ofstream & _tvFile,
  * @param _tvFileSettings The corresponding test vector file settings.
  * @param _comment The comment to be written to the test vector file.
  */
-void TVGenerator::WriteTVCommentLine(ofstream & _tvFile,
-		TVFileSettings & _tvFileSettings, string _comment) {
-	_tvFile << _tvFileSettings.getCommentIndicator() << " " << _comment << endl;
+void TVGenerator::WriteTVCommentLine(ostream & _tvFile,
+		TVFileSettings & _tvFileSettings, const TVStringView & _comment) {
+	FlushVectorBuffers();
+	_tvFile << _tvFileSettings.getCommentIndicator() << " " << _comment << '\n';
 }
 
 /**
  * @brief Write the description of the signals into the test vector file.
+ *
+ * The caption is rendered only once per initialization and reused afterwards,
+ * since it solely depends on the file settings.
+ *
  * @param _tvFile The test vector file to which the signal caption should be
  *   written.
  * @param _tvFileSettings The corresponding test vector file settings.
  */
-void TVGenerator::WriteSignalCaptions(ofstream & _tvFile, TVFileSettings & _tvFileSettings)
+void TVGenerator::WriteSignalCaptions(ostream & _tvFile,
+		const TVFileSettings & _tvFileSettings)
+{
+	string & caption = (&_tvFileSettings == &stimFileSettings_) ? stimCaption_ :
+			(&_tvFileSettings == &expRspFileSettings_) ? expRspCaption_ : tvCaption_;
+
+	if (caption.empty()) {
+		caption = RenderSignalCaptions(_tvFileSettings);
+	}
+	_tvFile << caption;
+}
+
+/**
+ * @brief Render the description of the signals as it should appear in the
+ *   test vector file.
+ * @param _fileSettings The corresponding test vector file settings.
+ * @return The signal caption (incl. the final line break).
+ */
+string TVGenerator::RenderSignalCaptions(const TVFileSettings & _fileSettings)
 {
-	const vector<SignalDeclaration> & sigDecls = _tvFileSettings.getTVDeclarations();
+	stringstream ssResult;
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	const int timeColumns = _fileSettings.isEnableTimeColumn() ? 1 : 0;
+
+	// Determine the number of digits of every column, i.e., the number of digits
+	// required in the specified number base to represent the value of a signal
+	// (preceded by the time column, if enabled).
+	vector<int> columnDigits;
+	if (timeColumns > 0) {
+		columnDigits.push_back(_fileSettings.getTimeColumnDigits());
+	}
+	for (size_t i = 0; i < sigDecls.size(); ++i) {
+		columnDigits.push_back(sigDecls[i].GetDigitCount());
+	}
 
 	// Create an empty comment line in the test vector file.
-	_tvFile << _tvFileSettings.getCommentIndicator() << endl;
+	ssResult << _fileSettings.getCommentIndicator() << '\n';
+
+	if (timeColumns > 0) {
+		ssResult << GeneratePreSignalCaptionString(_fileSettings, columnDigits, 0);
+		ssResult << _fileSettings.getTimeColumnName();
+		if (_fileSettings.isEnableDeltaTime()) {
+			ssResult << " (delta)";
+		}
+		ssResult << '\n';
+	}
 
 	for (size_t i = 0; i < sigDecls.size(); ++i) {
 
 		// Create the string (signal caption), describing the next signal.
-		_tvFile << GeneratePreSignalCaptionString(_tvFileSettings, i);
-		_tvFile << sigDecls[i].GetName();
+		ssResult << GeneratePreSignalCaptionString(_fileSettings, columnDigits,
+				timeColumns + i);
+		ssResult << sigDecls[i].GetName();
 
 		// If specified, append the width of the signal in the caption of the
 		// respective signal.
 		if (sigDecls[i].IsAppendWidthInCaption()) {
-			_tvFile << " (" << sigDecls[i].GetWidth() << " bit)";
+			ssResult << " (" << sigDecls[i].GetWidth() << " bit)";
 		}
 
-		_tvFile << endl;
+		ssResult << '\n';
 	}
 
-	_tvFile << GeneratePreSignalCaptionString(_tvFileSettings, sigDecls.size());
+	ssResult << GeneratePreSignalCaptionString(_fileSettings, columnDigits,
+			columnDigits.size());
 
 	// If specified, append the last header column indicating the start of the
 	// line-end comments.
-	if (_tvFileSettings.isEnableLineEndComments()) {
-		_tvFile << string(_tvFileSettings.getCommentSpaces() -
-				_tvFileSettings.getSignalDistance(), ' ');
-		_tvFile << _tvFileSettings.getCommentsColumnHeader() << endl;
-		_tvFile << GeneratePreSignalCaptionString(_tvFileSettings, sigDecls.size());
-		_tvFile << string(_tvFileSettings.getCommentSpaces() -
-				_tvFileSettings.getSignalDistance(), ' ');
-		_tvFile << _tvFileSettings.getColumnIndicator();
+	if (_fileSettings.isEnableLineEndComments()) {
+		ssResult << string(_fileSettings.getCommentSpaces() -
+				_fileSettings.getSignalDistance(), ' ');
+		ssResult << _fileSettings.getCommentsColumnHeader() << '\n';
+		ssResult << GeneratePreSignalCaptionString(_fileSettings, columnDigits,
+				columnDigits.size());
+		ssResult << string(_fileSettings.getCommentSpaces() -
+				_fileSettings.getSignalDistance(), ' ');
+		ssResult << _fileSettings.getColumnIndicator();
 	}
-	_tvFile << endl;
+	ssResult << '\n';
+	return ssResult.str();
 }
 
 /**
@@ -258,39 +714,28 @@ void TVGenerator::WriteSignalCaptions(ofstream & _tvFile, TVFileSettings & _tvFi
  * of the signal columns).
  *
  * @param _tvFileSettings The corresponding test vector file settings.
- * @param _sigIndex The index of the signal for which the leading string should
- *   be created.
- * @return The created string in front of the actual signal name.
+ * @param _columnDigits The number of digits of every column.
+ * @param _columnIndex The index of the column (time column or signal) for which
+ *   the leading string should be created.
+ * @return The created string in front of the actual column name.
  */
 string TVGenerator::GeneratePreSignalCaptionString(const TVFileSettings & _tvFileSettings,
-		const int _sigIndex)
+		const vector<int> & _columnDigits, const int _columnIndex)
 {
-	int offset 				= 0;
-	float widthDigits	= 0;
-	float logBase 		= 0;
+	int offset = 0;
 	stringstream ssResult;
-	SignalDeclaration currSigDecl;
-
-	const vector<SignalDeclaration> & sigDecls = _tvFileSettings.getTVDeclarations();
 
 	ssResult << _tvFileSettings.getCommentIndicator();
 
-	for (int i = 0; i < _sigIndex; ++i) {
-		currSigDecl = sigDecls[i];
-
+	for (int i = 0; i < _columnIndex; ++i) {
 		offset = (i == 0) ?
 				_tvFileSettings.getCommentIndicator().length() :
 				_tvFileSettings.getColumnIndicator().length();
 
-		// Determine the number of digits required in the specified number base to
-		// represent the value of the current signal.
-		logBase 		= log(currSigDecl.GetPrintBase()) / log(2);
-		widthDigits = ceil((float)currSigDecl.GetWidth()/ logBase);
-
-		ssResult << string(widthDigits - offset, ' ');
+		ssResult << string(_columnDigits[i] - offset, ' ');
 		ssResult << string(_tvFileSettings.getSignalDistance(), ' ');
 
-		if (_sigIndex > 1 && i!= _sigIndex-1) {
+		if (_columnIndex > 1 && i!= _columnIndex-1) {
 			ssResult << _tvFileSettings.getColumnIndicator();
 		}
 	}
@@ -299,10 +744,768 @@ string TVGenerator::GeneratePreSignalCaptionString(const TVFileSettings & _tvFil
 
 
 
+/**
+ * @brief Open a test vector file using a stream buffer owned by the
+ *   TVGenerator.
+ *
+ * The buffer is larger than the default one (unless configured otherwise
+ * using EnableLowFootprint()) and is kept across files, i.e., re-opening files
+ * using Restart() does not allocate a new one.
+ *
+ * @param _file The file stream to be opened.
+ * @param _buffer The buffer to be used by the file stream.
+ * @param _filePath The path of the file to be opened.
+ * @param _mode The mode to open the file with.
+ */
+void TVGenerator::OpenFile(ofstream & _file, vector<char> & _buffer,
+		const string & _filePath, const ios_base::openmode _mode) {
+	if (_buffer.size() != fileBufferSize_) {
+		vector<char>(fileBufferSize_).swap(_buffer);
+	}
+	_file.rdbuf()->pubsetbuf(&_buffer[0], _buffer.size());
+	_file.open(_filePath.c_str(), _mode);
+}
+
+/**
+ * @brief Set up the stream the TVGenerator writes to for a certain target.
+ *
+ * If content hashing is enabled in the file settings, the data is routed
+ * through a hash buffer in front of the target stream. The layout of the file
+ * is validated (see ValidateLayout()), its toggle coverage (if enabled) and its
+ * time column start from scratch and its vector buffer (if enabled) is
+ * allocated.
+ *
+ * @param _stream The stream pointer to be set up.
+ * @param _target The stream the data should end up in.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _hashBuffer The hash buffer to be used for the target.
+ * @param _hashStream The stream writing to the hash buffer.
+ */
+void TVGenerator::AttachStream(ostream * & _stream, ostream & _target,
+		const TVFileSettings & _fileSettings, TVHashBuffer & _hashBuffer,
+		ostream & _hashStream) {
+	ValidateLayout(_fileSettings);
+	_hashBuffer.Reset(_target.rdbuf());
+	if (_fileSettings.isEnableContentHash()) {
+		_hashStream.rdbuf(&_hashBuffer);
+		_stream = &_hashStream;
+	} else {
+		_stream = &_target;
+	}
+	if (_fileSettings.isEnableToggleCoverage()) {
+		GetToggleCoverage(_fileSettings).Reset(_fileSettings);
+	}
+	// The writer follows the stream pointer, which is only set up afterwards.
+	ostream * const * stream = &_stream;
+	const TVFileSettings * fileSettings = &_fileSettings;
+	GetVectorBuffer(_fileSettings).Reset(_fileSettings.getTVDeclarations(),
+			vectorBufferSize_, commentBufferSize_, isBackgroundFormatting_,
+			[this, stream, fileSettings](TVVectorBuffer::Batch & _batch,
+					const int _tvCount) {
+				WriteVectorBuffer(**stream, *fileSettings, _batch, _tvCount);
+			});
+	GetLastTime(_fileSettings) = -1;
+
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	vector<string> & rendered = GetRenderedValues(_fileSettings);
+	rendered.resize(sigDecls.size());
+	for (size_t sig = 0; sig < sigDecls.size(); ++sig) {
+		rendered[sig].reserve(sigDecls[sig].GetDigitCount());
+	}
+}
+
+/**
+ * @brief Prepare the state of a stream for the next file written using the
+ *   same settings (see Restart()).
+ *
+ * In contrast to AttachStream(), the layout is not validated again and the
+ * vector buffer (empty after Finalize()), the rendered values as well as the
+ * toggle coverage keep their allocations.
+ *
+ * @param _target The stream of the next file.
+ * @param _fileSettings The corresponding test vector file settings.
+ * @param _hashBuffer The content hash of the file.
+ */
+void TVGenerator::RestartStream(ostream & _target,
+		const TVFileSettings & _fileSettings, TVHashBuffer & _hashBuffer) {
+	_hashBuffer.Reset(_target.rdbuf());
+	if (_fileSettings.isEnableToggleCoverage()) {
+		GetToggleCoverage(_fileSettings).Clear();
+	}
+	GetLastTime(_fileSettings) = -1;
+}
+
+/**
+ * @brief Get the toggle coverage belonging to the provided file settings.
+ * @param _fileSettings One of the TVGenerator's test vector file settings.
+ * @return The toggle coverage of the corresponding test vector file.
+ */
+TVToggleCoverage & TVGenerator::GetToggleCoverage(
+		const TVFileSettings & _fileSettings) {
+	return (&_fileSettings == &stimFileSettings_) ? stimCoverage_ :
+			(&_fileSettings == &expRspFileSettings_) ? expRspCoverage_ : tvCoverage_;
+}
+
+/**
+ * @brief Account for a test vector line formatted by the caller in the toggle
+ *   coverage.
+ *
+ * The values are taken from the digits as they appear in the file, a value
+ * consisting of don't care identifiers only counts as don't care.
+ *
+ * @param _fileSettings The corresponding test vector file settings.
+ * @param _values The formatted values (without the time column).
+ */
+void TVGenerator::UpdateToggleCoverage(const TVFileSettings & _fileSettings,
+		const TVStringView & _values) {
+	const char * const end = _values.data() + _values.size();
+	const size_t signalCount = _fileSettings.getTVDeclarations().size();
+	TVStringView token;
+
+	// Check the number of values first, so the coverage is left untouched if
+	// the line is rejected.
+	size_t valueCount = 0;
+	for (const char * pos = _values.data(); NextToken(pos, end, token); ) {
+		valueCount++;
+	}
+	if (valueCount != signalCount) {
+		throw invalid_argument("The formatted test vector line holds " +
+				to_string(valueCount) + " values instead of " +
+				to_string(signalCount) + ".");
+	}
+
+	TVToggleCoverage & coverage = GetToggleCoverage(_fileSettings);
+	const char dontCare = _fileSettings.getDontCareIdentifier();
+	const char * pos = _values.data();
+	for (size_t sig = 0; NextToken(pos, end, token); ++sig) {
+		if (find_if(token.data(), token.data() + token.size(),
+				[dontCare](const char _c) { return _c != dontCare; }) ==
+				token.data() + token.size()) {
+			coverage.UpdateDontCare(sig);
+		} else {
+			coverage.Update(sig, token);
+		}
+	}
+	coverage.NextVector();
+}
+
+/**
+ * @brief Get the time of the last test vector written to the file belonging to
+ *   the provided file settings.
+ * @param _fileSettings One of the TVGenerator's test vector file settings.
+ * @return The time of the last test vector (-1 if none has been written yet).
+ */
+long long & TVGenerator::GetLastTime(const TVFileSettings & _fileSettings) {
+	return (&_fileSettings == &stimFileSettings_) ? stimTime_ :
+			(&_fileSettings == &expRspFileSettings_) ? expRspTime_ : tvTime_;
+}
+
+/**
+ * @brief Determine the absolute time of the next test vector of a file.
+ *
+ * A negative time stands for "no time given", i.e., the test vector follows
+ * its predecessor by one time unit (the first one being at time 0). Unless the
+ * validation policy is kValidateRelease (where the caller guarantees it),
+ * times have to be non-decreasing and can only be given if the time column is
+ * enabled.
+ *
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _time The time given for the test vector (or -1).
+ * @return The absolute time of the test vector.
+ */
+long long TVGenerator::ResolveTime(const TVFileSettings & _fileSettings,
+		const long long _time) {
+	const long long lastTime = GetLastTime(_fileSettings);
+	if (_time < 0) {
+		return lastTime + 1;
+	}
+	if (validationPolicy_ != kValidateRelease) {
+		if (!_fileSettings.isEnableTimeColumn()) {
+			throw logic_error("Bad function call: Test vector file '" +
+					_fileSettings.getFilePath() + "' has no time column.");
+		}
+		if (_time < lastTime) {
+			throw invalid_argument("Time " + to_string(_time) + " precedes the time " +
+					to_string(lastTime) + " of the previous test vector of file '" +
+					_fileSettings.getFilePath() + "'.");
+		}
+	}
+	return _time;
+}
+
+/**
+ * @brief Record the absolute time of a test vector and get the value of its
+ *   time column.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _time The absolute time of the test vector (see ResolveTime()).
+ * @return The distance to the previous test vector if delta encoding is
+ *   enabled (the first test vector being written with its absolute time),
+ *   the absolute time otherwise.
+ */
+long long TVGenerator::EncodeTime(const TVFileSettings & _fileSettings,
+		const long long _time) {
+	long long & lastTime = GetLastTime(_fileSettings);
+	const long long timeValue = (_fileSettings.isEnableDeltaTime() && lastTime >= 0) ?
+			_time - lastTime : _time;
+	lastTime = _time;
+	return timeValue;
+}
+
+/**
+ * @brief Get the vector buffer belonging to the provided file settings.
+ * @param _fileSettings One of the TVGenerator's test vector file settings.
+ * @return The vector buffer of the corresponding test vector file.
+ */
+TVVectorBuffer & TVGenerator::GetVectorBuffer(
+		const TVFileSettings & _fileSettings) {
+	return (&_fileSettings == &stimFileSettings_) ? stimVectorBuffer_ :
+			(&_fileSettings == &expRspFileSettings_) ? expRspVectorBuffer_ :
+			tvVectorBuffer_;
+}
+
+/**
+ * @brief Format and write a batch of test vectors of a vector buffer.
+ *
+ * The values are rendered column by column first, the lines (incl. repeated
+ * signal captions and line-end comments) are written afterwards. The toggle
+ * coverage is updated from the rendered columns.
+ *
+ * Runs on the worker thread of the vector buffer in background mode, hence,
+ * it must only touch the stream, coverage and caption of the given file.
+ *
+ * @param _tvFile The stream to which the test vectors should be written.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _batch The batch of test vectors to be written.
+ * @param _tvCount The number of test vectors of the file incl. the batch.
+ */
+void TVGenerator::WriteVectorBuffer(ostream & _tvFile,
+		const TVFileSettings & _fileSettings, TVVectorBuffer::Batch & _batch,
+		const int _tvCount) {
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+	const size_t rowCount = _batch.GetSize();
+	const size_t sigCount = _batch.GetSignalCount();
+	_batch.Render(sigDecls, _fileSettings.getDontCareIdentifier());
+
+	if (_fileSettings.isEnableToggleCoverage()) {
+		TVToggleCoverage & coverage = GetToggleCoverage(_fileSettings);
+		for (size_t sig = 0; sig < sigCount; ++sig) {
+			for (size_t row = 0; row < rowCount; ++row) {
+				if (_batch.IsDontCare(row, sig)) {
+					coverage.UpdateDontCare(sig);
+				} else {
+					coverage.Update(sig, _batch.GetRendered(row, sig));
+				}
+			}
+		}
+		for (size_t row = 0; row < rowCount; ++row) {
+			coverage.NextVector();
+		}
+	}
+
+	const int captionInterval = _fileSettings.getSignalCaptionInterval();
+	for (size_t row = 0; row < rowCount; ++row) {
+		const int tvCount = _tvCount - (int)rowCount + (int)row;
+		if (tvCount > 0 && tvCount % captionInterval == 0) {
+			WriteSignalCaptions(_tvFile, _fileSettings);
+		}
+		if (_fileSettings.isEnableTimeColumn()) {
+			WriteTime(_tvFile, _batch.GetTime(row),
+					_fileSettings.getTimeColumnDigits());
+			_tvFile << " ";
+		}
+		for (size_t sig = 0; sig < sigCount; ++sig) {
+			_tvFile << _batch.GetRendered(row, sig);
+			if (sig != sigCount - 1) {
+				_tvFile << " ";
+			}
+		}
+		WriteLineEndComment(_tvFile, _fileSettings, _batch.GetComment(row));
+		_tvFile << '\n';
+	}
+}
+
+/**
+ * @brief Write the test vectors held by all vector buffers and wait until
+ *   they have been written.
+ *
+ * Has to be called before anything else is written to the streams or the
+ * coverage is read, as the buffered test vectors may be written by a worker
+ * thread.
+ */
+void TVGenerator::FlushVectorBuffers() {
+	if (isSingleFileBased_) {
+		tvVectorBuffer_.Dispatch(testVectorCount_);
+		tvVectorBuffer_.Wait();
+	} else {
+		stimVectorBuffer_.Dispatch(stimuliCount_);
+		expRspVectorBuffer_.Dispatch(expRspCount_);
+		stimVectorBuffer_.Wait();
+		expRspVectorBuffer_.Wait();
+	}
+}
+
+/**
+ * @brief Make sure a comment to be buffered does not exceed the comment buffer
+ *   in low-footprint mode (where the buffers must not grow).
+ * @param _comment The comment to be buffered.
+ */
+void TVGenerator::CheckBufferedComment(const TVStringView & _comment) const {
+	if (isLowFootprint_ && _comment.size() > commentBufferSize_) {
+		throw invalid_argument("Comment of " + to_string(_comment.size()) +
+				" bytes exceeds the comment buffer of " +
+				to_string(commentBufferSize_) + " bytes.");
+	}
+}
+
+/**
+ * @brief Write the toggle coverage summary to the end of a test vector file
+ *   (if enabled and not written yet).
+ * @param _tvFile The stream to which the summary should be written.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ */
+void TVGenerator::WriteToggleCoverageReport(ostream & _tvFile,
+		const TVFileSettings & _fileSettings) {
+	TVToggleCoverage & coverage = GetToggleCoverage(_fileSettings);
+	if (_fileSettings.isEnableToggleCoverage() && coverage.IsActive()) {
+		coverage.WriteReport(_tvFile, _fileSettings.getCommentIndicator());
+	}
+}
+
+/**
+ * @brief Write a checkpoint if checkpoints are enabled and the current test
+ *   vector count is due (and, for two files, both files are in sync).
+ */
+void TVGenerator::MaybeWriteCheckpoint() {
+	if (checkpointInterval_ <= 0) {
+		return;
+	}
+	if (isSingleFileBased_) {
+		if (testVectorCount_ % checkpointInterval_ == 0) {
+			WriteCheckpoint();
+		}
+	} else if (stimuliCount_ == expRspCount_ &&
+			stimuliCount_ % checkpointInterval_ == 0) {
+		WriteCheckpoint();
+	}
+}
+
+/**
+ * @brief Flush a single file and record its state in the checkpoint.
+ * @param _checkpoint The checkpoint to which the state is appended.
+ * @param _prefix The prefix of the checkpoint entries of the file.
+ * @param _stream The stream the TVGenerator writes to.
+ * @param _file The underlying file stream.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _hashBuffer The hash buffer of the file.
+ * @param _tvCount The number of test vectors written to the file.
+ */
+void TVGenerator::CheckpointFile(ostream & _checkpoint, const string & _prefix,
+		ostream & _stream, ofstream & _file, const TVFileSettings & _fileSettings,
+		const TVHashBuffer & _hashBuffer, const int _tvCount) {
+	_stream.flush();
+	const long long offset = _file.tellp();
+	if (!_stream || offset < 0) {
+		throw runtime_error("Unable to write test vector file '" +
+				_fileSettings.getFilePath() + "'.");
+	}
+	SyncFile(_fileSettings.getFilePath());
+
+	_checkpoint << _prefix << "-path=" << _fileSettings.getFilePath() << '\n';
+	_checkpoint << _prefix << "-offset=" << offset << '\n';
+	_checkpoint << _prefix << "-count=" << _tvCount << '\n';
+	_checkpoint << _prefix << "-caption-interval=" <<
+			_fileSettings.getSignalCaptionInterval() << '\n';
+	_checkpoint << _prefix << "-hash=" << _hashBuffer.GetHash() << '\n';
+	_checkpoint << _prefix << "-time=" << GetLastTime(_fileSettings) << '\n';
+}
+
+/**
+ * @brief Restore a single file to the state recorded in a checkpoint, i.e.,
+ *   drop everything written after the checkpoint and continue appending.
+ * @param _checkpoint The entries of the checkpoint.
+ * @param _prefix The prefix of the checkpoint entries of the file.
+ * @param _stream The stream pointer to be set up.
+ * @param _file The file stream to be opened.
+ * @param _buffer The buffer to be used by the file stream.
+ * @param _fileSettings The corresponding settings of the test vector file.
+ * @param _hashBuffer The hash buffer of the file.
+ * @param _hashStream The stream writing to the hash buffer.
+ * @return The number of test vectors written to the file up to the checkpoint.
+ */
+int TVGenerator::ResumeFile(const map<string, string> & _checkpoint,
+		const string & _prefix, ostream * & _stream, ofstream & _file,
+		vector<char> & _buffer, const TVFileSettings & _fileSettings,
+		TVHashBuffer & _hashBuffer, ostream & _hashStream) {
+	const string filePath = _fileSettings.getFilePath();
+	map<string, string>::const_iterator path = _checkpoint.find(_prefix + "-path");
+	map<string, string>::const_iterator offset = _checkpoint.find(_prefix + "-offset");
+	map<string, string>::const_iterator count = _checkpoint.find(_prefix + "-count");
+	map<string, string>::const_iterator interval =
+			_checkpoint.find(_prefix + "-caption-interval");
+	map<string, string>::const_iterator hash = _checkpoint.find(_prefix + "-hash");
+	map<string, string>::const_iterator time = _checkpoint.find(_prefix + "-time");
+
+	if (path == _checkpoint.end() || offset == _checkpoint.end() ||
+			count == _checkpoint.end() || interval == _checkpoint.end() ||
+			hash == _checkpoint.end()) {
+		throw invalid_argument("Checkpoint '" + checkpointPath_ + "' is incomplete.");
+	}
+	if (path->second != filePath ||
+			atoi(interval->second.c_str()) != _fileSettings.getSignalCaptionInterval()) {
+		throw invalid_argument("Checkpoint '" + checkpointPath_ + "' does not match "
+				"the settings of test vector file '" + filePath + "'.");
+	}
+
+	const long long fileOffset = atoll(offset->second.c_str());
+	if (truncate(filePath.c_str(), fileOffset) != 0) {
+		throw runtime_error("Unable to truncate test vector file '" + filePath +
+				"' to its last checkpoint.");
+	}
+	OpenFile(_file, _buffer, filePath, ios::out | ios::app);
+	AttachStream(_stream, _file, _fileSettings, _hashBuffer, _hashStream);
+	_hashBuffer.Reset(_file.rdbuf(), strtoull(hash->second.c_str(), NULL, 10),
+			fileOffset);
+	if (_fileSettings.isEnableToggleCoverage()) {
+		GetToggleCoverage(_fileSettings).SetFirstVector(atoll(count->second.c_str()));
+	}
+	if (time != _checkpoint.end()) {
+		GetLastTime(_fileSettings) = atoll(time->second.c_str());
+	}
+
+	return atoi(count->second.c_str());
+}
+
+/**
+ * @brief Read the entries of the checkpoint file.
+ * @return The entries (key/value pairs) of the checkpoint.
+ */
+map<string, string> TVGenerator::ReadCheckpoint() {
+	if (checkpointPath_.empty()) {
+		throw logic_error("Bad function call: Checkpoints have not been enabled. "
+				"Call 'EnableCheckpoints' first.");
+	}
+
+	ifstream checkpointFile(checkpointPath_.c_str());
+	if (!checkpointFile) {
+		throw runtime_error("Unable to read checkpoint '" + checkpointPath_ + "'.");
+	}
+
+	map<string, string> checkpoint;
+	string line;
+	while (getline(checkpointFile, line)) {
+		const size_t separator = line.find('=');
+		if (separator != string::npos) {
+			checkpoint[line.substr(0, separator)] = line.substr(separator + 1);
+		}
+	}
+	return checkpoint;
+}
+
+/**
+ * @brief Force the data of a file to the disk.
+ * @param _filePath The path of the file.
+ */
+void TVGenerator::SyncFile(const string & _filePath) {
+	const int fd = open(_filePath.c_str(), O_RDONLY);
+	if (fd < 0 || fsync(fd) != 0) {
+		if (fd >= 0) {
+			close(fd);
+		}
+		throw runtime_error("Unable to sync '" + _filePath + "' to disk.");
+	}
+	close(fd);
+}
+
 // ****************************************************************************
 // Public methods
 // ****************************************************************************
 
+/**
+ * @brief Enable periodic checkpoints.
+ *
+ * Must be called before Initialize() or Resume(). Whenever the configured
+ * number of test vectors has been written (in case of two files: to both of
+ * them), the files are flushed and synced to disk and their sizes, test
+ * vector counts and content hashes are recorded in the checkpoint file. Only
+ * files opened by the TVGenerator itself can be checkpointed.
+ *
+ * @param _checkpointPath The path of the checkpoint file.
+ * @param _interval The number of test vectors between two checkpoints.
+ */
+void TVGenerator::EnableCheckpoints(const string & _checkpointPath,
+		const int _interval) {
+	if (_interval < 1) {
+		throw invalid_argument("The checkpoint interval must be positive.");
+	}
+	checkpointPath_			= _checkpointPath;
+	checkpointInterval_	= _interval;
+}
+
+/**
+ * @brief Enable buffering test vectors in memory and formatting them in
+ *   batches.
+ *
+ * Must be called before Initialize() or Resume(). Instead of being formatted
+ * right away, the values passed to WriteTestVectorLine(), WriteStimuliLine(),
+ * WriteExpRspLine() and WriteCycle() are stored in a batch. Whenever a batch
+ * is full, its values are rendered in one go and the lines are written, while
+ * a second batch takes the next test vectors. Buffered test vectors are
+ * written before any other line (arbitrary lines, comment lines, formatted
+ * test vector lines), before checkpoints and in Finalize(). Hence, content
+ * hashes and the toggle coverage only cover the test vectors written so far
+ * (and must not be read while a batch is formatted in the background, i.e.,
+ * before one of the calls above).
+ *
+ * The memory used per file is bounded by twice the number of test vectors
+ * (their values in both binary and rendered form) and the comment bytes
+ * given.
+ *
+ * @param _vectorCount The number of test vectors buffered per file (0 disables
+ *   buffering).
+ * @param _commentBytes The number of comment bytes buffered per file.
+ * @param _isBackgroundFormatting Whether a full buffer is formatted and
+ *   written by a worker thread per file while the next one fills up (or by
+ *   the calling thread).
+ */
+void TVGenerator::EnableVectorBuffer(const size_t _vectorCount,
+		const size_t _commentBytes, const bool _isBackgroundFormatting) {
+	vectorBufferSize_				= _vectorCount;
+	commentBufferSize_			= _commentBytes;
+	isBackgroundFormatting_	= _isBackgroundFormatting;
+}
+
+/**
+ * @brief Enable the low-footprint mode for hosts with little memory.
+ *
+ * Must be called before Initialize() or Resume(). All memory used for writing
+ * test vectors is allocated once when the files are opened and does not grow
+ * afterwards:
+ *   - The file buffers have the given size (instead of 64 KiB).
+ *   - The vector buffers (see EnableVectorBuffer()) have a fixed capacity, a
+ *     comment exceeding the comment buffer is rejected instead of growing it.
+ *
+ * Writing a test vector may still allocate temporarily (all of it is released
+ * before the write returns):
+ *   - StdLogicVector::ToString() returns a new string for every value with
+ *     more digits than a string holds without allocating (typically 15). The
+ *     values are rendered one after the other, i.e., a single such string of
+ *     at most the digit count of the widest signal is alive at a time.
+ *   - The overloads of WriteTestVectorLine() taking constant values copy them
+ *     first, i.e., one StdLogicVector per signal. Pass modifiable values to
+ *     avoid the copy.
+ *   - The vector buffers copy-assign the values into their slots, which
+ *     allocates if (and as much as) the assignment of StdLogicVector does.
+ * Hence, the memory is bounded by the preallocated buffers plus one rendered
+ * value and one copy of the values of a test vector. Checkpoints, Restart()
+ * and Finalize() allocate temporarily as well. The settings of the files are
+ * held once (see ReleaseUnusedFileSettings()).
+ *
+ * In addition, the latency of every test vector write is recorded in the
+ * histogram returned by GetStats(). The peak resident set size is reported
+ * irrespective of the mode.
+ *
+ * @param _fileBufferSize The size of the buffer of every file opened by the
+ *   TVGenerator in bytes.
+ */
+void TVGenerator::EnableLowFootprint(const size_t _fileBufferSize) {
+	if (_fileBufferSize < 1) {
+		throw invalid_argument("The file buffer must hold at least one byte.");
+	}
+	isLowFootprint_	= true;
+	fileBufferSize_	= _fileBufferSize;
+	memset(writeLatencyHistogram_, 0, sizeof(writeLatencyHistogram_));
+}
+
+/**
+ * @brief Write a checkpoint right away.
+ *
+ * The checkpoint file is replaced atomically, i.e., after a crash it either
+ * holds the previous or the new checkpoint.
+ */
+void TVGenerator::WriteCheckpoint() {
+	if (checkpointPath_.empty()) {
+		throw logic_error("Bad function call: Checkpoints have not been enabled. "
+				"Call 'EnableCheckpoints' first.");
+	}
+	if (!ownsStreams_) {
+		throw logic_error("Bad function call: Only files opened by the TVGenerator "
+				"itself can be checkpointed.");
+	}
+	if (!isSingleFileBased_ && stimuliCount_ != expRspCount_) {
+		throw logic_error("Number of stimuli and expected responses differ. "
+				"Checkpoints can only be written after complete cycles.");
+	}
+	FlushVectorBuffers();
+
+	stringstream ssCheckpoint;
+	ssCheckpoint << "single-file=" << isSingleFileBased_ << '\n';
+	if (isSingleFileBased_) {
+		CheckpointFile(ssCheckpoint, "tv", *tvStream_, tvFile_, tvFileSettings_,
+				tvHashBuffer_, testVectorCount_);
+	} else {
+		CheckpointFile(ssCheckpoint, "stim", *stimStream_, stimFile_,
+				stimFileSettings_, stimHashBuffer_, stimuliCount_);
+		CheckpointFile(ssCheckpoint, "exprsp", *expRspStream_, expRspFile_,
+				expRspFileSettings_, expRspHashBuffer_, expRspCount_);
+	}
+
+	const string tmpPath = checkpointPath_ + ".tmp";
+	ofstream checkpointFile(tmpPath.c_str(), ios::out | ios::trunc);
+	checkpointFile << ssCheckpoint.str();
+	checkpointFile.close();
+	if (checkpointFile.fail()) {
+		throw runtime_error("Unable to write checkpoint '" + tmpPath + "'.");
+	}
+	SyncFile(tmpPath);
+	if (rename(tmpPath.c_str(), checkpointPath_.c_str()) != 0) {
+		throw runtime_error("Unable to write checkpoint '" + checkpointPath_ + "'.");
+	}
+
+	// Make the rename itself durable.
+	const size_t separator = checkpointPath_.find_last_of('/');
+	SyncFile(separator == string::npos ? "." :
+			(separator == 0 ? "/" : checkpointPath_.substr(0, separator)));
+}
+
+/**
+ * @brief Continue writing a single test vector file from its last checkpoint.
+ *
+ * Everything written after the last checkpoint is removed from the file and
+ * the TVGenerator continues appending to it (no new file header is written).
+ * The caller has to replay its model from the returned test vector onwards.
+ * The toggle coverage (if enabled) only covers the test vectors written after
+ * resuming, its summary is marked as partial.
+ *
+ * @param _tvFileSettings The settings the file has been written with.
+ * @return The number of test vectors contained in the file.
+ */
+int TVGenerator::Resume(TVFileSettings _tvFileSettings) {
+	const map<string, string> checkpoint = ReadCheckpoint();
+	map<string, string>::const_iterator singleFile = checkpoint.find("single-file");
+	if (singleFile == checkpoint.end() || singleFile->second != "1") {
+		throw invalid_argument("Checkpoint '" + checkpointPath_ + "' has not been "
+				"written for a single test vector file.");
+	}
+
+	isSingleFileBased_	= true;
+	tvFileSettings_			= move(_tvFileSettings);
+	ReleaseUnusedFileSettings();
+	ownsStreams_				= true;
+	tvCaption_.clear();
+	tvHeader_.clear();
+	testVectorCount_ = ResumeFile(checkpoint, "tv", tvStream_, tvFile_,
+			tvFileBuffer_, tvFileSettings_, tvHashBuffer_, tvHashStream_);
+
+	return testVectorCount_;
+}
+
+/**
+ * @brief Continue writing separate stimuli and expected responses files from
+ *   their last checkpoint.
+ * @param _stimFileSettings The settings the stimuli file has been written with.
+ * @param _expRspFileSettings The settings the expected responses file has been
+ *   written with.
+ * @return The number of cycles contained in the files.
+ * @see TVGenerator::Resume(TVFileSettings _tvFileSettings)
+ */
+int TVGenerator::Resume(TVFileSettings _stimFileSettings,
+		TVFileSettings _expRspFileSettings) {
+	const map<string, string> checkpoint = ReadCheckpoint();
+	map<string, string>::const_iterator singleFile = checkpoint.find("single-file");
+	if (singleFile == checkpoint.end() || singleFile->second != "0") {
+		throw invalid_argument("Checkpoint '" + checkpointPath_ + "' has not been "
+				"written for separate stimuli and expected responses files.");
+	}
+
+	isSingleFileBased_	= false;
+	stimFileSettings_		= move(_stimFileSettings);
+	expRspFileSettings_	= move(_expRspFileSettings);
+	ReleaseUnusedFileSettings();
+	ownsStreams_				= true;
+	stimCaption_.clear();
+	stimHeader_.clear();
+	expRspCaption_.clear();
+	expRspHeader_.clear();
+	stimuliCount_ = ResumeFile(checkpoint, "stim", stimStream_, stimFile_,
+			stimFileBuffer_, stimFileSettings_, stimHashBuffer_, stimHashStream_);
+	expRspCount_ = ResumeFile(checkpoint, "exprsp", expRspStream_, expRspFile_,
+			expRspFileBuffer_, expRspFileSettings_, expRspHashBuffer_,
+			expRspHashStream_);
+
+	return stimuliCount_;
+}
+
+/**
+ * @brief Estimate the size of a test vector file, e.g., in order to preallocate
+ *   it (see TVDirectFileBuffer).
+ *
+ * The estimation covers the file header, the repeated signal captions and the
+ * test vector lines themselves. Line-end comments (and the toggle coverage
+ * report) are not known in advance and hence not taken into account.
+ *
+ * @param _fileSettings The settings of the test vector file.
+ * @param _vectorCount The number of test vectors expected to be written.
+ * @return The estimated file size in bytes.
+ */
+long long TVGenerator::EstimateFileSize(const TVFileSettings & _fileSettings,
+		const long long _vectorCount) {
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+
+	// Every value is followed by a separator or the line break.
+	long long lineLength = 0;
+	for (size_t i = 0; i < sigDecls.size(); ++i) {
+		lineLength += sigDecls[i].GetDigitCount() + 1;
+	}
+	if (_fileSettings.isEnableTimeColumn()) {
+		lineLength += _fileSettings.getTimeColumnDigits() + 1;
+	}
+
+	const long long headerSize = RenderTVFileHeader(_fileSettings,
+			FormatHeaderTime(time(0)), true).length();
+
+	const long long captionSize = RenderSignalCaptions(_fileSettings).length();
+	const long long captionCount = 1 + (_vectorCount > 0 ?
+			(_vectorCount - 1) / _fileSettings.getSignalCaptionInterval() : 0);
+
+	return headerSize + captionCount * captionSize + _vectorCount * lineLength;
+}
+
+/**
+ * @brief Get the statistics of the TVGenerator.
+ * @return The validation policy in use, the number of lines written, the peak
+ *   resident set size of the process and (in low-footprint mode, see
+ *   EnableLowFootprint()) the latency histogram of the test vector writes.
+ */
+TVGeneratorStats TVGenerator::GetStats() const {
+	TVGeneratorStats stats;
+	stats.validationPolicy	= validationPolicy_;
+	stats.testVectorCount		= testVectorCount_;
+	stats.stimuliCount			= stimuliCount_;
+	stats.expRspCount				= expRspCount_;
+
+	struct rusage usage;
+	stats.peakResidentKBytes = (getrusage(RUSAGE_SELF, &usage) == 0) ?
+			usage.ru_maxrss : -1;
+	memcpy(stats.writeLatencyHistogram, writeLatencyHistogram_,
+			sizeof(writeLatencyHistogram_));
+	return stats;
+}
+
+/**
+ * @brief Get the name of a validation policy (e.g., for reports).
+ * @param _validationPolicy The validation policy.
+ * @return The name of the validation policy.
+ */
+string TVGenerator::GetValidationPolicyName(
+		const TVValidationPolicy _validationPolicy) {
+	switch (_validationPolicy) {
+	case kValidateStrict:		return "strict";
+	case kValidateRelease:	return "release";
+	default:								return "default";
+	}
+}
+
+
 /**
  * @brief Initialize the TVGenerator using a single settings object.
  * @param _tvFileSettings The settings to be used in order to initialize the
@@ -313,10 +1516,52 @@ string TVGenerator::GeneratePreSignalCaptionString(const TVFileSettings & _tvFil
  */
 void TVGenerator::Initialize(TVFileSettings _tvFileSettings) {
   isSingleFileBased_ = true;
-  tvFileSettings_   = _tvFileSettings;
-  tvFile_.open(tvFileSettings_.getFilePath().c_str());
+  tvFileSettings_   = move(_tvFileSettings);
+  ReleaseUnusedFileSettings();
+  tvCaption_.clear();
+  tvHeader_.clear();
+  ownsStreams_       = true;
+  OpenFile(tvFile_, tvFileBuffer_, tvFileSettings_.getFilePath(),
+      ios::out | ios::trunc);
+  AttachStream(tvStream_, tvFile_, tvFileSettings_, tvHashBuffer_, tvHashStream_);
 
   WriteTVFileHeader();
+  if (checkpointInterval_ > 0) {
+    WriteCheckpoint();
+  }
+}
+
+/**
+ * @brief Initialize the TVGenerator using a single settings object and an
+ *   already existing output stream.
+ * @param _tvFileSettings The settings to be used in order to initialize the
+ *   TVGenerator.
+ * @param _tvStream The stream to which the test vectors should be written
+ *   instead of the file path given in the settings (e.g., a stream on top of
+ *   a @c TVRingBuffer). It must outlive the TVGenerator's use of it.
+ *
+ * Checkpoints (see EnableCheckpoints()) are only supported for files opened by
+ * the TVGenerator itself, hence, a logic_error is thrown before anything is
+ * written if they are enabled.
+ */
+void TVGenerator::Initialize(TVFileSettings _tvFileSettings, ostream & _tvStream) {
+	if (checkpointInterval_ > 0) {
+		throw logic_error("Bad function call: Only files opened by the TVGenerator "
+				"itself can be checkpointed.");
+	}
+	isSingleFileBased_	= true;
+	tvFileSettings_			= move(_tvFileSettings);
+	ReleaseUnusedFileSettings();
+	ownsStreams_				= false;
+	tvCaption_.clear();
+	tvHeader_.clear();
+	AttachStream(tvStream_, _tvStream, tvFileSettings_, tvHashBuffer_,
+			tvHashStream_);
+
+	WriteTVFileHeader();
+	if (checkpointInterval_ > 0) {
+		WriteCheckpoint();
+	}
 }
 
 /**
@@ -332,21 +1577,90 @@ void TVGenerator::Initialize(TVFileSettings _tvFileSettings) {
 void TVGenerator::Initialize(TVFileSettings _stimFileSettings,
 		TVFileSettings _expRspFileSettings){
 	isSingleFileBased_	= false;
-	stimFileSettings_		= _stimFileSettings;
-	expRspFileSettings_	= _expRspFileSettings;
-	stimFile_.open(stimFileSettings_.getFilePath().c_str());
-	expRspFile_.open(expRspFileSettings_.getFilePath().c_str());
+	stimFileSettings_		= move(_stimFileSettings);
+	expRspFileSettings_	= move(_expRspFileSettings);
+	ReleaseUnusedFileSettings();
+	stimCaption_.clear();
+	stimHeader_.clear();
+	expRspCaption_.clear();
+	expRspHeader_.clear();
+	ownsStreams_				= true;
+	OpenFile(stimFile_, stimFileBuffer_, stimFileSettings_.getFilePath(),
+			ios::out | ios::trunc);
+	OpenFile(expRspFile_, expRspFileBuffer_, expRspFileSettings_.getFilePath(),
+			ios::out | ios::trunc);
+	AttachStream(stimStream_, stimFile_, stimFileSettings_, stimHashBuffer_,
+			stimHashStream_);
+	AttachStream(expRspStream_, expRspFile_, expRspFileSettings_,
+			expRspHashBuffer_, expRspHashStream_);
 
 	WriteTVFileHeader();
+	if (checkpointInterval_ > 0) {
+		WriteCheckpoint();
+	}
+}
+
+/**
+ * @brief Initialize the TVGenerator using two separate settings objects and
+ *   two already existing output streams.
+ * @param _stimFileSettings The settings to be used for the stimuli.
+ * @param _stimStream The stream to which the stimuli should be written.
+ * @param _expRspFileSettings The settings to be used for the expected
+ *   responses.
+ * @param _expRspStream The stream to which the expected responses should be
+ *   written.
+ *
+ * Checkpoints are not supported (see Initialize(TVFileSettings, ostream &)).
+ */
+void TVGenerator::Initialize(TVFileSettings _stimFileSettings,
+		ostream & _stimStream, TVFileSettings _expRspFileSettings,
+		ostream & _expRspStream) {
+	if (checkpointInterval_ > 0) {
+		throw logic_error("Bad function call: Only files opened by the TVGenerator "
+				"itself can be checkpointed.");
+	}
+	isSingleFileBased_	= false;
+	stimFileSettings_		= move(_stimFileSettings);
+	expRspFileSettings_	= move(_expRspFileSettings);
+	ReleaseUnusedFileSettings();
+	ownsStreams_				= false;
+	stimCaption_.clear();
+	stimHeader_.clear();
+	expRspCaption_.clear();
+	expRspHeader_.clear();
+	AttachStream(stimStream_, _stimStream, stimFileSettings_, stimHashBuffer_,
+			stimHashStream_);
+	AttachStream(expRspStream_, _expRspStream, expRspFileSettings_,
+			expRspHashBuffer_, expRspHashStream_);
+
+	WriteTVFileHeader();
+	if (checkpointInterval_ > 0) {
+		WriteCheckpoint();
+	}
 }
 
 /**
  * @brief Finalizes the TVGenerator object.
  *
+ * Lines are not flushed individually while writing (the streams' buffers
+ * decide when data hits the file, pipe, etc.), hence, all streams are flushed
+ * here.
+ *
  * Must be called after using the TVGenerator in order to close open file
- * connections, etc.
+ * connections, etc. Streams handed over by the caller are only flushed. If
+ * toggle coverage is enabled, its summary is appended as comment lines.
  */
 void TVGenerator::Finalize() {
+  FlushVectorBuffers();
+  if (isSingleFileBased_) {
+    WriteToggleCoverageReport(*tvStream_, tvFileSettings_);
+  } else {
+    WriteToggleCoverageReport(*stimStream_, stimFileSettings_);
+    WriteToggleCoverageReport(*expRspStream_, expRspFileSettings_);
+  }
+  tvStream_->flush();
+  stimStream_->flush();
+  expRspStream_->flush();
   if (tvFile_) {
     tvFile_.close();
   }
@@ -358,6 +1672,63 @@ void TVGenerator::Finalize() {
   }
 }
 
+/**
+ * @brief Finalize the current test vector file and continue with a new one.
+ *
+ * This allows to generate a large number of small test vector files with a
+ * single TVGenerator: the settings (which are not validated again), the
+ * rendered header and signal captions, the file and vector buffers as well as
+ * the toggle coverage are reused, only the file path within the header
+ * changes. The test
+ * vector count starts from zero again.
+ *
+ * @param _filePath The path of the next test vector file.
+ */
+void TVGenerator::Restart(const string & _filePath) {
+	if (!isSingleFileBased_ || !ownsStreams_) {
+		throw logic_error("Bad function call: Only a TVGenerator writing a single "
+				"file it has opened itself can be restarted using a single file path.");
+	}
+	Finalize();
+	testVectorCount_ = 0;
+	tvFileSettings_.setFilePath(_filePath);
+	OpenFile(tvFile_, tvFileBuffer_, _filePath, ios::out | ios::trunc);
+	RestartStream(tvFile_, tvFileSettings_, tvHashBuffer_);
+
+	WriteTVFileHeader();
+	if (checkpointInterval_ > 0) {
+		WriteCheckpoint();
+	}
+}
+
+/**
+ * @copydoc TVGenerator::Restart(const string & _filePath)
+ * @param _stimFilePath The path of the next stimuli file.
+ * @param _expRspFilePath The path of the next expected responses file.
+ */
+void TVGenerator::Restart(const string & _stimFilePath,
+		const string & _expRspFilePath) {
+	if (isSingleFileBased_ || !ownsStreams_) {
+		throw logic_error("Bad function call: Only a TVGenerator writing two files "
+				"it has opened itself can be restarted using two file paths.");
+	}
+	Finalize();
+	stimuliCount_	= 0;
+	expRspCount_	= 0;
+	stimFileSettings_.setFilePath(_stimFilePath);
+	expRspFileSettings_.setFilePath(_expRspFilePath);
+	OpenFile(stimFile_, stimFileBuffer_, _stimFilePath, ios::out | ios::trunc);
+	OpenFile(expRspFile_, expRspFileBuffer_, _expRspFilePath,
+			ios::out | ios::trunc);
+	RestartStream(stimFile_, stimFileSettings_, stimHashBuffer_);
+	RestartStream(expRspFile_, expRspFileSettings_, expRspHashBuffer_);
+
+	WriteTVFileHeader();
+	if (checkpointInterval_ > 0) {
+		WriteCheckpoint();
+	}
+}
+
 /**
  * @brief Write a single test vector line to the test vector file.
  * @param _signalValues The values of the signals to be used.
@@ -365,16 +1736,107 @@ void TVGenerator::Finalize() {
  *   line in case it has been enabled in the test vector file settings.
  * @return 0 when successfully. Throws an exception otherwise.
  */
-int TVGenerator::WriteTestVectorLine(vector<StdLogicVector> _signalValues,
-      string _comment) {
+int TVGenerator::WriteTestVectorLine(vector<StdLogicVector> & _signalValues,
+    const TVStringView & _comment) {
+  return WriteTestVectorLine(_signalValues, -1, _comment);
+}
+
+/**
+ * @copydoc TVGenerator::WriteTestVectorLine(vector<StdLogicVector> & _signalValues, const TVStringView & _comment)
+ * @param _time The time of the test vector written to the time column (a
+ *   negative time continues one time unit after the previous test vector).
+ *   Idle periods are expressed by a gap to the previous time.
+ */
+int TVGenerator::WriteTestVectorLine(vector<StdLogicVector> & _signalValues,
+    const long long _time, const TVStringView & _comment) {
+  WriteTimer timer(*this);
   if (!isSingleFileBased_) {
     throw logic_error("Bad function call: Test vector has *not* been set up "
         "for single file application. Hence, do not use the "
         "'WriteTestVectorLine' function but the "
         "'WriteStimuliLine/WriteExpectedResponseLine' functions.");
   }
-  return WriteTVLine(
-  			tvFile_, tvFileSettings_, _signalValues, _comment, testVectorCount_);
+  return WriteTVLine(*tvStream_, tvFileSettings_, _signalValues, _time,
+  		_comment, testVectorCount_);
+}
+
+/**
+ * @copydoc TVGenerator::WriteTestVectorLine(vector<StdLogicVector> & _signalValues, const TVStringView & _comment)
+ *
+ * Accepts temporary and constant values, which are copied first (rendering
+ * requires modifiable values). Pass a modifiable vector to avoid the copy.
+ */
+int TVGenerator::WriteTestVectorLine(const vector<StdLogicVector> & _signalValues,
+    const TVStringView & _comment) {
+  vector<StdLogicVector> signalValues(_signalValues);
+  return WriteTestVectorLine(signalValues, -1, _comment);
+}
+
+/**
+ * @copydoc TVGenerator::WriteTestVectorLine(const vector<StdLogicVector> & _signalValues, const TVStringView & _comment)
+ * @param _time The time of the test vector (see WriteTestVectorLine()).
+ */
+int TVGenerator::WriteTestVectorLine(const vector<StdLogicVector> & _signalValues,
+    const long long _time, const TVStringView & _comment) {
+  vector<StdLogicVector> signalValues(_signalValues);
+  return WriteTestVectorLine(signalValues, _time, _comment);
+}
+
+/**
+ * @brief Write an already formatted test vector line to the test vector file.
+ *
+ * In contrast to WriteArbitraryTVLine(), the line is counted as a test vector,
+ * i.e., the signal captions are repeated according to the file settings and
+ * the time column (if enabled) is written in front of the values. This is used
+ * to re-emit test vectors read from an existing file (see TVTransformer).
+ * If toggle coverage is enabled, the values are accounted for based on their
+ * digits, hence, there has to be one value per signal in its print base.
+ *
+ * @param _values The formatted signal values of the test vector (without the
+ *   time column).
+ * @param _comment The comment which will be added to the end of the test vector
+ *   line in case it has been enabled in the test vector file settings.
+ * @return 0 when successfully. Throws an exception otherwise.
+ */
+int TVGenerator::WriteFormattedTestVectorLine(const TVStringView & _values,
+		const TVStringView & _comment) {
+	return WriteFormattedTestVectorLine(_values, -1, _comment);
+}
+
+/**
+ * @copydoc TVGenerator::WriteFormattedTestVectorLine(const TVStringView & _values, const TVStringView & _comment)
+ * @param _time The time of the test vector (see WriteTestVectorLine()).
+ */
+int TVGenerator::WriteFormattedTestVectorLine(const TVStringView & _values,
+		const long long _time, const TVStringView & _comment) {
+	WriteTimer timer(*this);
+	if (!isSingleFileBased_) {
+		throw logic_error("Bad function call: Test vector has *not* been set up "
+				"for single file application. Hence, do not use the "
+				"'WriteFormattedTestVectorLine' function.");
+	}
+	const long long time = ResolveTime(tvFileSettings_, _time);
+	FlushVectorBuffers();
+	if (tvFileSettings_.isEnableToggleCoverage()) {
+		UpdateToggleCoverage(tvFileSettings_, _values);
+	}
+	if (testVectorCount_ > 0 &&
+			testVectorCount_ % tvFileSettings_.getSignalCaptionInterval() == 0) {
+		WriteSignalCaptions(*tvStream_, tvFileSettings_);
+	}
+	if (tvFileSettings_.isEnableTimeColumn()) {
+		WriteTime(*tvStream_, EncodeTime(tvFileSettings_, time),
+				tvFileSettings_.getTimeColumnDigits());
+		*tvStream_ << " ";
+	}
+	*tvStream_ << _values;
+	WriteLineEndComment(*tvStream_, tvFileSettings_, _comment);
+	*tvStream_ << '\n';
+
+	testVectorCount_++;
+	MaybeWriteCheckpoint();
+
+	return 0;
 }
 
 /**
@@ -384,14 +1846,25 @@ int TVGenerator::WriteTestVectorLine(vector<StdLogicVector> _signalValues,
  * @return 0 when successfully. Throws an exception otherwise.
  */
 int TVGenerator::WriteStimuliLine(vector<StdLogicVector> & _stimuliValues,
-		string _comment) {
-	if ( isSingleFileBased_) {
+		const TVStringView & _comment) {
+	return WriteStimuliLine(_stimuliValues, -1, _comment);
+}
+
+/**
+ * @copydoc TVGenerator::WriteStimuliLine(vector<StdLogicVector> & _stimuliValues, const TVStringView & _comment)
+ * @param _time The time of the stimuli written to the time column (see
+ *   WriteTestVectorLine()).
+ */
+int TVGenerator::WriteStimuliLine(vector<StdLogicVector> & _stimuliValues,
+		const long long _time, const TVStringView & _comment) {
+	WriteTimer timer(*this);
+	if (isSingleFileBased_) {
 		throw logic_error("Bad function call: Test vector has been set up "
 				"for single file application. Hence, use the 'WriteTestVectorLine'"
 				"function instead of 'WriteStimuliLine/WriteExpRspLine'");
 	}
-	return WriteTVLine(
-			stimFile_, stimFileSettings_, _stimuliValues, _comment, stimuliCount_);
+	return WriteTVLine(*stimStream_, stimFileSettings_, _stimuliValues, _time,
+			_comment, stimuliCount_);
 }
 
 /**
@@ -402,14 +1875,105 @@ int TVGenerator::WriteStimuliLine(vector<StdLogicVector> & _stimuliValues,
  * @return 0 when successfully. Throws an exception otherwise.
  */
 int TVGenerator::WriteExpRspLine(vector<StdLogicVector> & _expRspValues,
-		string _comment) {
-	if ( isSingleFileBased_) {
+		const TVStringView & _comment) {
+	return WriteExpRspLine(_expRspValues, -1, _comment);
+}
+
+/**
+ * @copydoc TVGenerator::WriteExpRspLine(vector<StdLogicVector> & _expRspValues, const TVStringView & _comment)
+ * @param _time The time of the expected response written to the time column
+ *   (see WriteTestVectorLine()).
+ */
+int TVGenerator::WriteExpRspLine(vector<StdLogicVector> & _expRspValues,
+		const long long _time, const TVStringView & _comment) {
+	WriteTimer timer(*this);
+	if (isSingleFileBased_) {
 		throw logic_error("Bad function call: Test vector has been set up "
 				"for single file application. Hence, use the 'WriteTestVectorLine'"
 				"function instead of 'WriteStimuliLine/WriteExpRspLine'");
 	}
-	return WriteTVLine(
-			expRspFile_, expRspFileSettings_, _expRspValues, _comment, expRspCount_);
+	return WriteTVLine(*expRspStream_, expRspFileSettings_, _expRspValues, _time,
+			_comment, expRspCount_);
+}
+
+
+/**
+ * @brief Write a stimuli and its expected response within a single call.
+ *
+ * Both values are validated before anything is written, so either both lines
+ * end up in their files or none of them does. Hence, the stimuli and expected
+ * response counts can not drift apart. The two lines are formatted right into
+ * their streams.
+ *
+ * @param _stimuliValues The values of the stimuli signals to be written.
+ * @param _expRspValues The values of the expected response signals to be
+ *   written.
+ * @param _comment The comment to be attached at the end of both lines.
+ * @return 0 when successfully. Throws an exception otherwise.
+ */
+int TVGenerator::WriteCycle(vector<StdLogicVector> & _stimuliValues,
+		vector<StdLogicVector> & _expRspValues, const TVStringView & _comment) {
+	return WriteCycle(_stimuliValues, _expRspValues, -1, _comment);
+}
+
+/**
+ * @copydoc TVGenerator::WriteCycle(vector<StdLogicVector> & _stimuliValues, vector<StdLogicVector> & _expRspValues, const TVStringView & _comment)
+ * @param _time The time of the cycle written to the time columns of both files
+ *   (see WriteTestVectorLine()).
+ */
+int TVGenerator::WriteCycle(vector<StdLogicVector> & _stimuliValues,
+		vector<StdLogicVector> & _expRspValues, const long long _time,
+		const TVStringView & _comment) {
+	WriteTimer timer(*this);
+	if (isSingleFileBased_) {
+		throw logic_error("Bad function call: Test vector has been set up "
+				"for single file application. Hence, use the 'WriteTestVectorLine'"
+				"function instead of 'WriteCycle'");
+	}
+	if (stimuliCount_ != expRspCount_) {
+		throw logic_error("Number of stimuli and expected responses written so "
+				"far differ. Do not mix 'WriteCycle' with unpaired "
+				"'WriteStimuliLine/WriteExpRspLine' calls.");
+	}
+	ValidateSignalValues(_stimuliValues, stimFileSettings_);
+	ValidateSignalValues(_expRspValues, expRspFileSettings_);
+	const long long stimTime = ResolveTime(stimFileSettings_, _time);
+	const long long expRspTime = ResolveTime(expRspFileSettings_, _time);
+	const long long stimTimeValue = stimFileSettings_.isEnableTimeColumn() ?
+			EncodeTime(stimFileSettings_, stimTime) : 0;
+	const long long expRspTimeValue = expRspFileSettings_.isEnableTimeColumn() ?
+			EncodeTime(expRspFileSettings_, expRspTime) : 0;
+
+	if (stimVectorBuffer_.IsEnabled()) {
+		CheckBufferedComment(_comment);
+		if (!stimVectorBuffer_.CanAppend(_comment) ||
+				!expRspVectorBuffer_.CanAppend(_comment)) {
+			FlushVectorBuffers();
+		}
+		stimVectorBuffer_.Append(_stimuliValues, stimTimeValue, _comment);
+		expRspVectorBuffer_.Append(_expRspValues, expRspTimeValue, _comment);
+		stimuliCount_++;
+		expRspCount_++;
+		if (stimVectorBuffer_.IsFull() || expRspVectorBuffer_.IsFull()) {
+			stimVectorBuffer_.Dispatch(stimuliCount_);
+			expRspVectorBuffer_.Dispatch(expRspCount_);
+		}
+		MaybeWriteCheckpoint();
+		return 0;
+	}
+
+	FormatTVLine(*stimStream_, stimFileSettings_, _stimuliValues, stimTimeValue,
+			_comment, stimuliCount_);
+	*stimStream_ << '\n';
+	FormatTVLine(*expRspStream_, expRspFileSettings_, _expRspValues,
+			expRspTimeValue, _comment, expRspCount_);
+	*expRspStream_ << '\n';
+
+	stimuliCount_++;
+	expRspCount_++;
+	MaybeWriteCheckpoint();
+
+	return 0;
 }
 
 
@@ -417,91 +1981,94 @@ int TVGenerator::WriteExpRspLine(vector<StdLogicVector> & _expRspValues,
  * @brief Write an arbitrary line to the common test vector file.
  * @param _line The arbitrary line to be written to the file.
  */
-void TVGenerator::WriteArbitraryTVLine(string _line) {
+void TVGenerator::WriteArbitraryTVLine(const TVStringView & _line) {
 	WriteArbitraryTVLine(_line, "");
 }
 
 /**
- * @copydoc TVGenerator::WriteArbitraryTVLine(string _line)
+ * @copydoc TVGenerator::WriteArbitraryTVLine(const TVStringView & _line)
  * @param _comment The comment to be attached to the arbitrary test vector line.
  */
-void TVGenerator::WriteArbitraryTVLine(string _line, string _comment) {
+void TVGenerator::WriteArbitraryTVLine(const TVStringView & _line,
+		const TVStringView & _comment) {
 	if (!isSingleFileBased_) {
 		throw logic_error("Bad function call: Test vector generator has *not* been "
 				"set up for single file application. Hence, do not use the "
 				"'WriteCustomTVLine' function but the "
 				"'WriteCustomStimuliLine/WriteCustomExpRspLine' functions.");
 	}
-	WriteArbitraryTVLine(tvFile_, tvFileSettings_, _line, _comment);
+	WriteArbitraryTVLine(*tvStream_, tvFileSettings_, _line, _comment);
 }
 
 /**
  * @brief Write an arbitrary line to the stimuli file.
  * @param _line The arbitrary line to be written to the stimuli file.
  */
-void TVGenerator::WriteArbitraryStimuliLine(string _line) {
+void TVGenerator::WriteArbitraryStimuliLine(const TVStringView & _line) {
 	WriteArbitraryStimuliLine(_line, "");
 }
 /**
- * @copydoc TVGenerator::WriteArbitraryStimuliLine(string _line)
+ * @copydoc TVGenerator::WriteArbitraryStimuliLine(const TVStringView & _line)
  * @param _comment The comment to be attached to the arbitrary line of the
  *   stimuli file.
  */
 
-void TVGenerator::WriteArbitraryStimuliLine(string _line, string _comment) {
+void TVGenerator::WriteArbitraryStimuliLine(const TVStringView & _line,
+		const TVStringView & _comment) {
 	if (isSingleFileBased_) {
 		throw logic_error("Bad function call: Test vector generator has been set up "
 				"for single file application. Hence, do not use the "
 				"'WriteCustomStimuliLine/WriteCustomExpRspLine' functions but the "
 				"'WriteCustomTVLine' function instead.");
 		}
-	WriteArbitraryTVLine(stimFile_, stimFileSettings_, _line, _comment);
+	WriteArbitraryTVLine(*stimStream_, stimFileSettings_, _line, _comment);
 }
 
 /**
  * @brief Write an arbitrary line to the expected response file.
  * @param _line The arbitrary line to be written to the expected response file.
  */
-void TVGenerator::WriteArbitraryExpRspLine(string _line) {
+void TVGenerator::WriteArbitraryExpRspLine(const TVStringView & _line) {
 	WriteArbitraryExpRspLine(_line, "");
 }
 
 /**
- * @copydoc TVGenerator::WriteArbitraryExpRspLine(string _line)
+ * @copydoc TVGenerator::WriteArbitraryExpRspLine(const TVStringView & _line)
  * @param _comment The comment to be attached to the arbitrary line of the
  *   expected stimuli file.
  */
-void TVGenerator::WriteArbitraryExpRspLine(string _line, string _comment) {
+void TVGenerator::WriteArbitraryExpRspLine(const TVStringView & _line,
+		const TVStringView & _comment) {
 	if (isSingleFileBased_) {
 		throw logic_error("Bad function call: Test vector generator has been set up "
 				"for single file application. Hence, do not use the "
 				"'WriteCustomStimuliLine/WriteCustomExpRspLine' functions but the "
 				"'WriteCustomTVLine' function instead.");
 	}
-	WriteArbitraryTVLine(expRspFile_, expRspFileSettings_,_line, _comment);
+	WriteArbitraryTVLine(*expRspStream_, expRspFileSettings_,_line, _comment);
 }
 
 /**
  * @brief Write a comment line to the common test vector file.
  * @param _comment The comment to be written to the test vector file.
  */
-void TVGenerator::WriteTVCommentLine(string _comment) {
-	WriteTVCommentLine(tvFile_, tvFileSettings_, _comment);
+void TVGenerator::WriteTVCommentLine(const TVStringView & _comment) {
+	WriteTVCommentLine(*tvStream_, tvFileSettings_, _comment);
 }
 
 /**
  * @brief Write a comment line to the stimuli test vector file.
  * @param _comment The comment to be written to the stimuli file.
  */
-void TVGenerator::WriteStimuliCommentLine(string _comment) {
-	WriteTVCommentLine(stimFile_, stimFileSettings_, _comment);
+void TVGenerator::WriteStimuliCommentLine(const TVStringView & _comment) {
+	WriteTVCommentLine(*stimStream_, stimFileSettings_, _comment);
 }
 
 /**
  * @brief Write a comment line to the expected response file.
  * @param _comment The comment to be written to the expected response file.
  */
-void TVGenerator::WriteExpRspCommentLine(string _comment) {
-	WriteTVCommentLine(expRspFile_, expRspFileSettings_, _comment);
+void TVGenerator::WriteExpRspCommentLine(const TVStringView & _comment) {
+	WriteTVCommentLine(*expRspStream_, expRspFileSettings_, _comment);
 }
 
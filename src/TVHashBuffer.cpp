@@ -0,0 +1,185 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVHashBuffer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief A stream buffer hashing all data passed through it.
+ * @version 0.1
+ */
+
+#include <string>
+#include <stdio.h>
+
+#include "TVHashBuffer.h"
+
+using namespace std;
+
+/** FNV-1a offset basis (64 bit). */
+static const uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+
+/** FNV-1a prime (64 bit). */
+static const uint64_t kFnvPrime = 1099511628211ULL;
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Default constructor creates a hash buffer without a target. Use
+ *   Reset() to set one before writing.
+ */
+TVHashBuffer::TVHashBuffer() : target_(NULL), hash_(kFnvOffsetBasis),
+		byteCount_(0) {
+	setp(buffer_, buffer_ + sizeof(buffer_));
+}
+
+/**
+ * @brief Destructor
+ */
+TVHashBuffer::~TVHashBuffer() {
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Hash the buffered data and forward it to the target.
+ * @return True if the target accepted all data.
+ */
+bool TVHashBuffer::Forward() {
+	const streamsize length = pptr() - pbase();
+	if (length == 0) {
+		return true;
+	}
+	hash_ 			= Hash(pbase(), length, hash_);
+	byteCount_ += length;
+	setp(buffer_, buffer_ + sizeof(buffer_));
+	return target_ != NULL && target_->sputn(buffer_, length) == length;
+}
+
+/**
+ * @brief Forward the buffer once it is full.
+ * @param _c The character which did not fit into the buffer anymore.
+ * @return @c traits_type::eof() if forwarding failed.
+ */
+TVHashBuffer::int_type TVHashBuffer::overflow(int_type _c) {
+	if (!Forward()) {
+		return traits_type::eof();
+	}
+	if (!traits_type::eq_int_type(_c, traits_type::eof())) {
+		*pptr() = traits_type::to_char_type(_c);
+		pbump(1);
+	}
+	return traits_type::not_eof(_c);
+}
+
+/**
+ * @brief Forward all buffered data and flush the target.
+ * @return 0 if successfully, -1 otherwise.
+ */
+int TVHashBuffer::sync() {
+	if (!Forward() || target_ == NULL || target_->pubsync() != 0) {
+		return -1;
+	}
+	return 0;
+}
+
+
+// ****************************************************************************
+// Getter/Setter
+// ****************************************************************************
+
+/**
+ * @brief Get the hash of all data written so far (incl. buffered data).
+ * @return The FNV-1a hash.
+ */
+uint64_t TVHashBuffer::GetHash() const {
+	return Hash(pbase(), pptr() - pbase(), hash_);
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Start over with a new target (any buffered data is dropped).
+ * @param _target The stream buffer to which the data should be forwarded.
+ */
+void TVHashBuffer::Reset(streambuf * _target) {
+	target_			= _target;
+	hash_				= kFnvOffsetBasis;
+	byteCount_	= 0;
+	setp(buffer_, buffer_ + sizeof(buffer_));
+}
+
+/**
+ * @brief Continue with a new target, starting from a previously recorded hash
+ *   (e.g., when appending to a file written up to a checkpoint).
+ * @param _target The stream buffer to which the data should be forwarded.
+ * @param _hash The hash of the data already written.
+ * @param _byteCount The number of bytes already written.
+ */
+void TVHashBuffer::Reset(streambuf * _target, const uint64_t _hash,
+		const long long _byteCount) {
+	Reset(_target);
+	hash_				= _hash;
+	byteCount_	= _byteCount;
+}
+
+/**
+ * @brief Continue a 64-bit FNV-1a hash over the provided data.
+ * @param _data The data to be hashed.
+ * @param _length The number of bytes to be hashed.
+ * @param _hash The hash of the preceding data.
+ * @return The updated hash.
+ */
+uint64_t TVHashBuffer::Hash(const char * _data, const size_t _length,
+		uint64_t _hash) {
+	for (size_t i = 0; i < _length; ++i) {
+		_hash ^= (unsigned char)_data[i];
+		_hash *= kFnvPrime;
+	}
+	return _hash;
+}
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of the provided string.
+ * @param _data The data to be hashed.
+ * @return The hash.
+ */
+uint64_t TVHashBuffer::Hash(const string & _data) {
+	return Hash(_data.data(), _data.length(), kFnvOffsetBasis);
+}
+
+/**
+ * @brief Format a hash as a fixed-width hexadecimal string.
+ * @param _hash The hash to be formatted.
+ * @return The 16 hexadecimal digits of the hash.
+ */
+string TVHashBuffer::ToHexString(const uint64_t _hash) {
+	char buf[17];
+	snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)_hash);
+	return buf;
+}
@@ -0,0 +1,328 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVPipeBuffer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief A file descriptor sink for streaming test vectors to live consumers.
+ * @version 0.1
+ */
+
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "TVPipeBuffer.h"
+
+using namespace std;
+
+/**
+ * @brief Get a monotonic time stamp in milliseconds.
+ */
+static long long NowMs() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Constructor using an already open file descriptor (e.g., a pipe set
+ *   up by the calling process). The descriptor is not closed by the buffer.
+ * @param _fd The file descriptor to write to.
+ * @param _maxLatencyMs The maximum time in milliseconds data may stay in the
+ *   buffer before it is written (negative for no limit).
+ * @param _clock The clock the latency is measured with (NULL for the
+ *   monotonic system clock), e.g., to control the time in tests.
+ */
+TVPipeBuffer::TVPipeBuffer(const int _fd, const int _maxLatencyMs,
+		const Clock _clock) :
+		fd_(_fd), ownsFd_(false), broken_(false), maxLatencyMs_(_maxLatencyMs),
+		clock_(_clock ? _clock : NowMs), flushed_(NULL), committed_(NULL),
+		idleSinceMs_(0), stop_(false) {
+	Init();
+}
+
+/**
+ * @brief Constructor opening a named pipe for writing. The FIFO is created if
+ *   it does not exist yet. Blocks until the reading side has opened it.
+ * @param _fifoPath The path of the named pipe.
+ * @param _maxLatencyMs The maximum time in milliseconds data may stay in the
+ *   buffer before it is written (negative for no limit).
+ * @param _clock The clock the latency is measured with (NULL for the
+ *   monotonic system clock).
+ */
+TVPipeBuffer::TVPipeBuffer(const string & _fifoPath, const int _maxLatencyMs,
+		const Clock _clock) :
+		fd_(-1), ownsFd_(true), broken_(false), maxLatencyMs_(_maxLatencyMs),
+		clock_(_clock ? _clock : NowMs), flushed_(NULL), committed_(NULL),
+		idleSinceMs_(0), stop_(false) {
+
+	if (mkfifo(_fifoPath.c_str(), 0600) != 0 && errno != EEXIST) {
+		throw runtime_error("Unable to create named pipe '" + _fifoPath + "': " +
+				strerror(errno));
+	}
+	do {
+		fd_ = open(_fifoPath.c_str(), O_WRONLY);
+	} while (fd_ < 0 && errno == EINTR);
+	if (fd_ < 0) {
+		throw runtime_error("Unable to open named pipe '" + _fifoPath + "': " +
+				strerror(errno));
+	}
+	Init();
+}
+
+/**
+ * @brief Destructor writes the remaining data and closes the descriptor if it
+ *   has been opened by the buffer itself.
+ */
+TVPipeBuffer::~TVPipeBuffer() {
+	if (flusher_.joinable()) {
+		{
+			lock_guard<mutex> lock(mutex_);
+			stop_ = true;
+		}
+		wakeUp_.notify_one();
+		flusher_.join();
+	}
+	sync();
+	if (ownsFd_) {
+		close(fd_);
+	}
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Size the buffer according to the pipe's capacity (if the descriptor
+ *   is a pipe), so that a single write fills the pipe at once, set up the
+ *   empty put area and start the thread enforcing the maximum latency.
+ */
+void TVPipeBuffer::Init() {
+	size_t chunkSize = 65536;
+#ifdef F_GETPIPE_SZ
+	const int pipeSize = fcntl(fd_, F_GETPIPE_SZ);
+	if (pipeSize > 0) {
+		chunkSize = pipeSize;
+	}
+#endif
+	buffer_.resize(chunkSize);
+	setp(&buffer_[0], &buffer_[0]);
+	flushed_ = &buffer_[0];
+	committed_.store(flushed_);
+	idleSinceMs_ = clock_();
+	if (maxLatencyMs_ >= 0) {
+		flusher_ = thread(&TVPipeBuffer::RunFlusher, this);
+	}
+}
+
+/**
+ * @brief Get the interval in which the background thread checks the buffer.
+ */
+int TVPipeBuffer::GetCheckIntervalMs() const {
+	return max(1, maxLatencyMs_ / 2);
+}
+
+/**
+ * @brief Check the buffer periodically until the buffer is destroyed.
+ */
+void TVPipeBuffer::RunFlusher() {
+	unique_lock<mutex> lock(mutex_);
+	while (!stop_) {
+		lock.unlock();
+		FlushExpired();
+		lock.lock();
+		if (!stop_) {
+			wakeUp_.wait_for(lock, chrono::milliseconds(GetCheckIntervalMs()));
+		}
+	}
+}
+
+/**
+ * @brief Write the provided data completely to the descriptor.
+ *
+ * @c SIGPIPE is blocked while writing, so a vanished reader results in
+ * @c EPIPE instead of terminating the process. A signal raised by our own
+ * write is consumed before the signal mask is restored.
+ *
+ * @param _data The data to be written.
+ * @param _length The number of bytes to be written.
+ * @return True if all data has been written, false otherwise.
+ */
+bool TVPipeBuffer::WriteAll(const char * _data, size_t _length) {
+	if (broken_) {
+		return false;
+	}
+
+	sigset_t pipeSet, oldSet, pendingSet;
+	sigemptyset(&pipeSet);
+	sigaddset(&pipeSet, SIGPIPE);
+	sigpending(&pendingSet);
+	const bool wasPending = sigismember(&pendingSet, SIGPIPE);
+	pthread_sigmask(SIG_BLOCK, &pipeSet, &oldSet);
+
+	while (_length > 0) {
+		const ssize_t written = write(fd_, _data, _length);
+		if (written > 0) {
+			_data 	+= written;
+			_length -= written;
+		} else if (written < 0 && errno == EINTR) {
+			continue;
+		} else if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			struct pollfd pfd = { fd_, POLLOUT, 0 };
+			poll(&pfd, 1, -1);
+		} else {
+			if (errno == EPIPE && !wasPending) {
+				struct timespec zero = { 0, 0 };
+				sigtimedwait(&pipeSet, NULL, &zero);
+			}
+			broken_ = true;
+			break;
+		}
+	}
+
+	pthread_sigmask(SIG_SETMASK, &oldSet, NULL);
+	return !broken_;
+}
+
+/**
+ * @brief Write the buffered data up to the provided end (the caller has to
+ *   hold the mutex).
+ * @param _end The end of the data to be written.
+ * @return True if successfully, false otherwise.
+ */
+bool TVPipeBuffer::WriteCommitted(char * _end) {
+	const char * begin = flushed_;
+	flushed_ = _end;
+	return begin == _end || WriteAll(begin, _end - begin);
+}
+
+/**
+ * @brief Append data to the put area and hand it over to the background
+ *   thread. Only locks if the buffer is full.
+ *
+ * The put area always ends at its current position, so that single
+ * characters (e.g., the line ends written via @c put()) arrive in overflow()
+ * and are handed over as well.
+ *
+ * @param _data The data to be appended.
+ * @param _length The number of bytes to be appended.
+ * @return True if successfully, false if the buffer is broken.
+ */
+bool TVPipeBuffer::Put(const char * _data, size_t _length) {
+	char * const bufferEnd = &buffer_[0] + buffer_.size();
+	while (_length > 0) {
+		if (pptr() == bufferEnd && sync() != 0) {
+			return false;
+		}
+		const size_t chunk = min(_length, (size_t)(bufferEnd - pptr()));
+		memcpy(pptr(), _data, chunk);
+		char * const end = pptr() + chunk;
+		setp(pbase(), end);
+		pbump(end - pbase());
+		committed_.store(end, memory_order_release);
+		_data 	+= chunk;
+		_length -= chunk;
+	}
+	return !broken_;
+}
+
+/**
+ * @brief Append a single character.
+ * @param _c The character to be written.
+ * @return @c traits_type::eof() if the buffer is broken.
+ */
+TVPipeBuffer::int_type TVPipeBuffer::overflow(int_type _c) {
+	if (traits_type::eq_int_type(_c, traits_type::eof())) {
+		return broken_ ? traits_type::eof() : traits_type::not_eof(_c);
+	}
+	const char c = traits_type::to_char_type(_c);
+	return Put(&c, 1) ? _c : traits_type::eof();
+}
+
+/**
+ * @brief Append a character sequence.
+ * @param _data The data to be written.
+ * @param _length The number of bytes to be written.
+ * @return The number of bytes accepted, i.e., 0 if the buffer is broken (even
+ *   if writing failed on the background thread).
+ */
+streamsize TVPipeBuffer::xsputn(const char * _data, streamsize _length) {
+	return Put(_data, _length) ? _length : 0;
+}
+
+/**
+ * @brief Write all buffered data and continue at the start of the buffer.
+ * @return 0 if successfully, -1 otherwise.
+ */
+int TVPipeBuffer::sync() {
+	lock_guard<mutex> lock(mutex_);
+	const bool isWritten = WriteCommitted(pptr());
+	setp(&buffer_[0], &buffer_[0]);
+	flushed_ = &buffer_[0];
+	committed_.store(flushed_, memory_order_release);
+	idleSinceMs_ = clock_();
+	return isWritten ? 0 : -1;
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Write the data handed over so far if it might exceed the maximum
+ *   latency before the next check.
+ *
+ * Called by the background thread every half of the maximum latency. The age
+ * of the pending data is measured from the last check which found no data
+ * pending, i.e., it is never underestimated.
+ */
+void TVPipeBuffer::FlushExpired() {
+	if (maxLatencyMs_ < 0) {
+		return;
+	}
+	lock_guard<mutex> lock(mutex_);
+	char * committed = committed_.load(memory_order_acquire);
+	const long long nowMs = clock_();
+	if (committed == flushed_) {
+		idleSinceMs_ = nowMs;
+	} else if (nowMs - idleSinceMs_ + GetCheckIntervalMs() >= maxLatencyMs_) {
+		WriteCommitted(committed);
+		idleSinceMs_ = nowMs;
+	}
+}
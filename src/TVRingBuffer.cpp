@@ -0,0 +1,253 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVRingBuffer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief A shared-memory ring buffer sink for test vectors.
+ * @version 0.1
+ *
+ * This file provides the implementation of the producer side of the shared
+ * memory ring buffer. Synchronization between producer and consumer solely
+ * relies on the acquire/release ordering of the read and write positions.
+ */
+
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "TVRingBuffer.h"
+
+using namespace std;
+
+/**
+ * @brief Back off while waiting for the consumer (spin first, then sleep).
+ * @param _iteration The number of unsuccessful polls so far.
+ */
+static void WaitForConsumer(const int _iteration) {
+	if (_iteration < 64) {
+		sched_yield();
+	} else {
+		struct timespec ts = { 0, 50000 };
+		nanosleep(&ts, NULL);
+	}
+}
+
+/**
+ * @brief Get a monotonic time stamp in milliseconds.
+ */
+static long long NowMs() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Creates the shared memory segment of the ring buffer.
+ * @param _name The POSIX shared memory name (must start with a '/'), which
+ *   has to be passed to tvring_open() on the consumer side.
+ * @param _capacity The capacity of the ring in bytes (must be a power of two).
+ */
+TVRingBuffer::TVRingBuffer(const string & _name, const size_t _capacity) :
+		name_(_name), capacity_(_capacity), mapSize_(0), fd_(-1), header_(NULL),
+		data_(NULL), publishThreshold_(0), timeoutMs_(10000), broken_(false) {
+
+	if (capacity_ == 0 || (capacity_ & (capacity_ - 1)) != 0) {
+		throw invalid_argument("The capacity of the test vector ring buffer must "
+				"be a power of two.");
+	}
+
+	fd_ = shm_open(name_.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+	if (fd_ < 0) {
+		throw runtime_error("Unable to create shared memory segment '" + name_ +
+				"': " + strerror(errno));
+	}
+
+	mapSize_ = sizeof(TVRingHeader) + capacity_;
+	void * map = MAP_FAILED;
+	if (ftruncate(fd_, mapSize_) == 0) {
+		map = mmap(NULL, mapSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+	}
+	if (map == MAP_FAILED) {
+		const string error = strerror(errno);
+		close(fd_);
+		shm_unlink(name_.c_str());
+		throw runtime_error("Unable to map shared memory segment '" + name_ +
+				"': " + error);
+	}
+
+	header_ 					= static_cast<TVRingHeader *>(map);
+	data_ 						= static_cast<char *>(map) + sizeof(TVRingHeader);
+	header_->capacity = capacity_;
+	header_->closed 	= 0;
+	header_->consumer	= 0;
+	header_->head 		= 0;
+	header_->tail 		= 0;
+	__atomic_store_n(&header_->magic, TVRING_MAGIC, __ATOMIC_RELEASE);
+
+	setp(buffer_, buffer_ + sizeof(buffer_));
+}
+
+/**
+ * @brief Destructor
+ *
+ * Closes the ring (if not done yet) and removes the shared memory segment.
+ * Consumers which already opened the ring can still read the remaining data.
+ */
+TVRingBuffer::~TVRingBuffer() {
+	Close();
+	munmap(header_, mapSize_);
+	close(fd_);
+	shm_unlink(name_.c_str());
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Check whether the consumer has closed the ring or its process does
+ *   not exist anymore.
+ */
+bool TVRingBuffer::IsConsumerGone() const {
+	const uint32_t consumer = __atomic_load_n(&header_->consumer, __ATOMIC_ACQUIRE);
+	if (consumer == TVRING_DETACHED) {
+		return true;
+	}
+	return consumer != 0 && kill((pid_t)consumer, 0) != 0 && errno == ESRCH;
+}
+
+/**
+ * @brief Copy the provided data into the ring and make it visible to the
+ *   consumer. Blocks as long as the ring is full.
+ * @param _data The data to be published.
+ * @param _length The number of bytes to be published.
+ * @return False if the consumer has gone away or did not free any space
+ *   within the timeout (the remaining data is dropped).
+ */
+bool TVRingBuffer::Publish(const char * _data, size_t _length) {
+	uint64_t head = header_->head;
+	int iteration = 0;
+	long long waitingSinceMs = 0;
+
+	while (_length > 0) {
+		const uint64_t tail = __atomic_load_n(&header_->tail, __ATOMIC_ACQUIRE);
+		const size_t space = capacity_ - (size_t)(head - tail);
+		if (space == 0) {
+			if (iteration == 0) {
+				waitingSinceMs = NowMs();
+			} else if (IsConsumerGone() || NowMs() - waitingSinceMs > timeoutMs_) {
+				return false;
+			}
+			WaitForConsumer(iteration++);
+			continue;
+		}
+		iteration = 0;
+
+		// Do not wrap around within a single copy.
+		const size_t index = head & (capacity_ - 1);
+		size_t chunk = min(_length, space);
+		chunk = min(chunk, capacity_ - index);
+
+		memcpy(data_ + index, _data, chunk);
+		head 		+= chunk;
+		_data 	+= chunk;
+		_length -= chunk;
+		__atomic_store_n(&header_->head, head, __ATOMIC_RELEASE);
+	}
+	return true;
+}
+
+/**
+ * @brief Publish the local buffer once it is full.
+ * @param _c The character which did not fit into the local buffer anymore.
+ * @return Anything but @c traits_type::eof() if successful.
+ */
+TVRingBuffer::int_type TVRingBuffer::overflow(int_type _c) {
+	if (sync() != 0) {
+		return traits_type::eof();
+	}
+	if (!traits_type::eq_int_type(_c, traits_type::eof())) {
+		*pptr() = traits_type::to_char_type(_c);
+		pbump(1);
+	}
+	return traits_type::not_eof(_c);
+}
+
+/**
+ * @brief Buffer a character sequence and publish the buffered data if it
+ *   completes a line (and the publish threshold is reached).
+ * @param _s The characters to be written.
+ * @param _n The number of characters.
+ * @return The number of characters written (0 if the ring is broken).
+ */
+streamsize TVRingBuffer::xsputn(const char * _s, streamsize _n) {
+	const streamsize written = streambuf::xsputn(_s, _n);
+	if (written > 0 && (size_t)(pptr() - pbase()) >= publishThreshold_ &&
+			memchr(_s, '\n', written) != NULL && sync() != 0) {
+		return 0;
+	}
+	return broken_ ? 0 : written;
+}
+
+/**
+ * @brief Publish the locally buffered data to the consumer.
+ * @return 0 if successful, -1 if the ring is broken.
+ */
+int TVRingBuffer::sync() {
+	if (broken_) {
+		return -1;
+	}
+	if (pptr() > pbase()) {
+		broken_ = !Publish(pbase(), pptr() - pbase());
+		setp(buffer_, buffer_ + sizeof(buffer_));
+	}
+	return broken_ ? -1 : 0;
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Publish all remaining data and signal the consumer that no further
+ *   test vectors will follow.
+ */
+void TVRingBuffer::Close() {
+	if (header_->closed) {
+		return;
+	}
+	sync();
+	__atomic_store_n(&header_->closed, 1, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVRingConsumer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief C interface for reading test vectors from a shared-memory ring.
+ * @version 0.1
+ *
+ * This file provides the implementation of the consumer side of the shared
+ * memory ring buffer. Since it is meant to be called from DPI-C, it neither
+ * throws exceptions nor uses any C++ types in its interface.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "TVRingConsumer.h"
+
+/**
+ * @brief Consumer handle of an opened ring buffer.
+ */
+struct tvring {
+	int fd;
+	size_t mapSize;
+	TVRingHeader * header;
+	const char * data;
+	char * line;              /* Buffer holding the most recent line. */
+	size_t lineCapacity;
+	int error;                /* Set once a line did not fit into memory. */
+};
+
+/**
+ * @brief Back off while waiting for the producer (spin first, then sleep).
+ * @param _iteration The number of unsuccessful polls so far.
+ */
+static void WaitForProducer(const int _iteration) {
+	if (_iteration < 64) {
+		sched_yield();
+	} else {
+		struct timespec ts = { 0, 50000 };
+		nanosleep(&ts, NULL);
+	}
+}
+
+/**
+ * @brief Open an existing ring buffer created by a @c TVRingBuffer.
+ * @param name The shared memory name passed to the producer.
+ * @return The ring handle or NULL if the ring could not be opened (or there
+ *   is not enough memory for the handle).
+ */
+tvring_t * tvring_open(const char * name) {
+	int fd = shm_open(name, O_RDWR, 0);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(TVRingHeader)) {
+		close(fd);
+		return NULL;
+	}
+
+	void * map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		close(fd);
+		return NULL;
+	}
+
+	TVRingHeader * header = static_cast<TVRingHeader *>(map);
+	if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != TVRING_MAGIC) {
+		munmap(map, st.st_size);
+		close(fd);
+		return NULL;
+	}
+
+	tvring_t * ring = static_cast<tvring_t *>(malloc(sizeof(tvring_t)));
+	char * line = static_cast<char *>(malloc(256));
+	if (ring == NULL || line == NULL) {
+		free(ring);
+		free(line);
+		munmap(map, st.st_size);
+		close(fd);
+		return NULL;
+	}
+	ring->fd 						= fd;
+	ring->mapSize 			= st.st_size;
+	ring->header 				= header;
+	ring->data 					= static_cast<const char *>(map) + sizeof(TVRingHeader);
+	ring->lineCapacity 	= 256;
+	ring->line 					= line;
+	ring->error					= 0;
+	__atomic_store_n(&header->consumer, (uint32_t)getpid(), __ATOMIC_RELEASE);
+	return ring;
+}
+
+/**
+ * @brief Pull the next line (without the line break) out of the ring. Blocks
+ *   until a complete line is available.
+ * @param ring The ring handle.
+ * @return The line, which stays valid until the next call, or NULL once the
+ *   producer closed the ring and all lines have been consumed (or if a line
+ *   did not fit into memory, see tvring_error()).
+ */
+const char * tvring_next_line(tvring_t * ring) {
+	if (ring->error) {
+		return NULL;
+	}
+	TVRingHeader * header = ring->header;
+	const uint64_t mask = header->capacity - 1;
+	uint64_t tail = header->tail;
+	size_t length = 0;
+	int iteration = 0;
+
+	for (;;) {
+		const uint64_t head = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+
+		if (head == tail) {
+			// Check the closed flag only after having seen an empty ring, and
+			// re-check the write position afterwards to not lose the last bytes.
+			if (__atomic_load_n(&header->closed, __ATOMIC_ACQUIRE) &&
+					__atomic_load_n(&header->head, __ATOMIC_ACQUIRE) == tail) {
+				if (length == 0) {
+					return NULL;
+				}
+				ring->line[length] = '\0';
+				return ring->line;
+			}
+			WaitForProducer(iteration++);
+			continue;
+		}
+		iteration = 0;
+
+		while (tail != head) {
+			const char c = ring->data[tail & mask];
+			++tail;
+			if (c == '\n') {
+				__atomic_store_n(&header->tail, tail, __ATOMIC_RELEASE);
+				ring->line[length] = '\0';
+				return ring->line;
+			}
+			if (length + 1 >= ring->lineCapacity) {
+				char * line = static_cast<char *>(realloc(ring->line,
+						ring->lineCapacity * 2));
+				if (line == NULL) {
+					ring->error = 1;
+					return NULL;
+				}
+				ring->line 					= line;
+				ring->lineCapacity *= 2;
+			}
+			ring->line[length++] = c;
+		}
+
+		// Hand the consumed space back to the producer before waiting for the
+		// rest of the line.
+		__atomic_store_n(&header->tail, tail, __ATOMIC_RELEASE);
+	}
+}
+
+/**
+ * @brief Pull the next test vector out of the ring, i.e., skip empty lines and
+ *   lines starting with the comment indicator (file header, signal captions).
+ * @param ring The ring handle.
+ * @param commentIndicator The comment indicator of the test vector file
+ *   settings used on the producer side.
+ * @return The test vector line or NULL at the end of the stream.
+ */
+const char * tvring_next_vector(tvring_t * ring, const char * commentIndicator) {
+	const size_t indicatorLength = strlen(commentIndicator);
+	const char * line;
+
+	while ((line = tvring_next_line(ring)) != NULL) {
+		if (line[0] != '\0' &&
+				(indicatorLength == 0 || strncmp(line, commentIndicator, indicatorLength) != 0)) {
+			return line;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Check whether reading stopped since a line did not fit into memory
+ *   (as opposed to the producer having closed the ring).
+ * @param ring The ring handle.
+ * @return Non-zero if an error occurred.
+ */
+int tvring_error(const tvring_t * ring) {
+	return ring->error;
+}
+
+/**
+ * @brief Release the ring handle. A producer still waiting for free space
+ *   fails from now on.
+ * @param ring The ring handle.
+ */
+void tvring_close(tvring_t * ring) {
+	if (ring == NULL) {
+		return;
+	}
+	__atomic_store_n(&ring->header->consumer, TVRING_DETACHED, __ATOMIC_RELEASE);
+	munmap(ring->header, ring->mapSize);
+	close(ring->fd);
+	free(ring->line);
+	free(ring);
+}
@@ -0,0 +1,298 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVToggleCoverage.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Per-bit toggle coverage of the signals of a test vector file.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+#include "TVToggleCoverage.h"
+
+using namespace std;
+
+/**
+ * @brief Number of bits per digit of a base, or 0 if it is no power of two.
+ */
+static int BitsPerDigit(const int _base) {
+	int bits = 0;
+	while ((1 << bits) < _base) {
+		bits++;
+	}
+	return ((1 << bits) == _base) ? bits : 0;
+}
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Default constructor.
+ */
+TVToggleCoverage::TVToggleCoverage() : vectorCount_(0), firstVector_(0),
+		isCountDontCares_(false), isActive_(false) {
+}
+
+/**
+ * @brief Default destructor.
+ */
+TVToggleCoverage::~TVToggleCoverage() {
+}
+
+// ****************************************************************************
+// Getter/Setter
+// ****************************************************************************
+
+/**
+ * @brief Returns the number of bits of a signal which have seen both a rising
+ * and a falling transition.
+ * @param _sigIndex The index of the signal within its file settings.
+ */
+int TVToggleCoverage::GetCoveredBitCount(const size_t _sigIndex) const {
+	const SignalCoverage & signal = signals_[_sigIndex];
+	int count = 0;
+	for (int bit = 0; bit < signal.width; ++bit) {
+		if (signal.riseCounts[bit] > 0 && signal.fallCounts[bit] > 0) {
+			count++;
+		}
+	}
+	return count;
+}
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Packs the digits of a value into the current words of a signal.
+ *
+ * Power-of-two bases are unpacked digit by digit, any other base is
+ * accumulated by multiplying the words with the base.
+ *
+ * @param _signal The signal the value belongs to.
+ * @param _digits The value as written to the test vector file.
+ */
+void TVToggleCoverage::Pack(SignalCoverage & _signal,
+		const TVStringView & _digits) {
+	vector<uint64_t> & words = _signal.current;
+	fill(words.begin(), words.end(), 0);
+
+	const int bitsPerDigit = BitsPerDigit(_signal.printBase);
+	if (bitsPerDigit > 0) {
+		int pos = 0;
+		for (size_t i = _digits.size(); i-- > 0 && pos < _signal.width; ) {
+			const uint64_t digit = SignalDeclaration::DigitValue(_digits.data()[i]);
+			const int offset = pos % 64;
+			words[pos / 64] |= digit << offset;
+			if (offset + bitsPerDigit > 64 && (size_t)(pos / 64 + 1) < words.size()) {
+				words[pos / 64 + 1] |= digit >> (64 - offset);
+			}
+			pos += bitsPerDigit;
+		}
+	} else {
+		for (size_t i = 0; i < _digits.size(); ++i) {
+			uint64_t carry = SignalDeclaration::DigitValue(_digits.data()[i]);
+			for (size_t w = 0; w < words.size(); ++w) {
+				const uint64_t low = (words[w] & 0xffffffffULL) * _signal.printBase + carry;
+				const uint64_t high = (words[w] >> 32) * _signal.printBase + (low >> 32);
+				words[w] = (high << 32) | (low & 0xffffffffULL);
+				carry = high >> 32;
+			}
+		}
+	}
+
+	// Clear the digit bits beyond the signal width.
+	if (_signal.width % 64 != 0) {
+		words.back() &= (1ULL << (_signal.width % 64)) - 1;
+	}
+}
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Discards all collected coverage and prepares for the signals of a
+ * new test vector file.
+ * @param _fileSettings The settings of the test vector file.
+ */
+void TVToggleCoverage::Reset(const TVFileSettings & _fileSettings) {
+	const vector<SignalDeclaration> & sigDecls = _fileSettings.getTVDeclarations();
+
+	signals_.assign(sigDecls.size(), SignalCoverage());
+	for (size_t i = 0; i < sigDecls.size(); ++i) {
+		SignalCoverage & signal = signals_[i];
+		signal.name = sigDecls[i].GetName();
+		signal.width = sigDecls[i].GetWidth();
+		signal.printBase = sigDecls[i].GetPrintBase();
+		signal.hasPrevious = false;
+		signal.previous.assign((signal.width + 63) / 64, 0);
+		signal.current.assign((signal.width + 63) / 64, 0);
+		signal.riseCounts.assign(signal.width, 0);
+		signal.fallCounts.assign(signal.width, 0);
+		signal.toggleCount = 0;
+		signal.dontCareCount = 0;
+	}
+	vectorCount_ = 0;
+	firstVector_ = 0;
+	isCountDontCares_ = _fileSettings.isEnableDontCareCoverage();
+	isActive_ = true;
+}
+
+/**
+ * @brief Discards all collected coverage, but keeps the signals (e.g., for the
+ * next test vector file of the same layout).
+ */
+void TVToggleCoverage::Clear() {
+	for (size_t i = 0; i < signals_.size(); ++i) {
+		SignalCoverage & signal = signals_[i];
+		signal.hasPrevious = false;
+		fill(signal.previous.begin(), signal.previous.end(), 0);
+		fill(signal.current.begin(), signal.current.end(), 0);
+		fill(signal.riseCounts.begin(), signal.riseCounts.end(), 0);
+		fill(signal.fallCounts.begin(), signal.fallCounts.end(), 0);
+		signal.toggleCount = 0;
+		signal.dontCareCount = 0;
+	}
+	vectorCount_ = 0;
+	firstVector_ = 0;
+	isActive_ = true;
+}
+
+/**
+ * @brief Accounts for the next value of a signal.
+ * @param _sigIndex The index of the signal within its file settings.
+ * @param _digits The value in the print base of the signal.
+ */
+void TVToggleCoverage::Update(const size_t _sigIndex,
+		const TVStringView & _digits) {
+	SignalCoverage & signal = signals_[_sigIndex];
+	Pack(signal, _digits);
+
+	if (signal.hasPrevious) {
+		for (size_t w = 0; w < signal.current.size(); ++w) {
+			const uint64_t changed = signal.previous[w] ^ signal.current[w];
+			if (changed == 0) {
+				continue;
+			}
+			signal.toggleCount += __builtin_popcountll(changed);
+
+			uint64_t rising = changed & signal.current[w];
+			while (rising != 0) {
+				signal.riseCounts[w * 64 + __builtin_ctzll(rising)]++;
+				rising &= rising - 1;
+			}
+			uint64_t falling = changed & signal.previous[w];
+			while (falling != 0) {
+				signal.fallCounts[w * 64 + __builtin_ctzll(falling)]++;
+				falling &= falling - 1;
+			}
+		}
+	}
+	signal.previous.swap(signal.current);
+	signal.hasPrevious = true;
+}
+
+/**
+ * @brief Accounts for a don't care value of a signal.
+ * @param _sigIndex The index of the signal within its file settings.
+ */
+void TVToggleCoverage::UpdateDontCare(const size_t _sigIndex) {
+	SignalCoverage & signal = signals_[_sigIndex];
+	signal.hasPrevious = false;
+	if (isCountDontCares_) {
+		signal.dontCareCount++;
+	}
+}
+
+/**
+ * @brief Writes a summary of the collected coverage as comment lines.
+ *
+ * For every signal, the number of covered bits, the number of rising and
+ * falling transitions and (if enabled) the number of don't care values are
+ * listed, followed by the bits which have not been covered. If the coverage
+ * does not start with the first test vector of the file (see
+ * SetFirstVector()), the summary is marked as partial. The coverage is
+ * deactivated afterwards, i.e., it is reported only once.
+ *
+ * @param _os The stream to write the summary to.
+ * @param _commentIndicator The string starting a comment line.
+ */
+void TVToggleCoverage::WriteReport(ostream & _os, const string & _commentIndicator) {
+	_os << _commentIndicator << '\n';
+	_os << _commentIndicator << " Toggle coverage (" << vectorCount_
+			<< " test vectors";
+	if (firstVector_ > 0) {
+		_os << ", partial: test vectors " << firstVector_ << " to " <<
+				firstVector_ + vectorCount_ - 1 << " only";
+	}
+	_os << "):" << '\n';
+
+	for (size_t i = 0; i < signals_.size(); ++i) {
+		const SignalCoverage & signal = signals_[i];
+		long long riseCount = 0;
+		long long fallCount = 0;
+		for (int bit = 0; bit < signal.width; ++bit) {
+			riseCount += signal.riseCounts[bit];
+			fallCount += signal.fallCounts[bit];
+		}
+
+		_os << _commentIndicator << "   " << signal.name << ": "
+				<< GetCoveredBitCount(i) << "/" << signal.width << " bits toggled, "
+				<< riseCount << " rising, " << fallCount << " falling";
+		if (isCountDontCares_) {
+			_os << ", " << signal.dontCareCount << " don't care";
+		}
+		_os << '\n';
+
+		// List the uncovered bits as ranges (most significant first).
+		string uncovered;
+		for (int bit = signal.width - 1; bit >= 0; ) {
+			if (signal.riseCounts[bit] > 0 && signal.fallCounts[bit] > 0) {
+				bit--;
+				continue;
+			}
+			const int high = bit;
+			while (bit >= 0 && !(signal.riseCounts[bit] > 0 && signal.fallCounts[bit] > 0)) {
+				bit--;
+			}
+			if (!uncovered.empty()) {
+				uncovered += ", ";
+			}
+			uncovered += to_string(high);
+			if (high != bit + 1) {
+				uncovered += ":" + to_string(bit + 1);
+			}
+		}
+		if (!uncovered.empty()) {
+			_os << _commentIndicator << "     not toggled: " << uncovered << '\n';
+		}
+	}
+	_os << _commentIndicator << '\n';
+
+	isActive_ = false;
+}
@@ -0,0 +1,400 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVTransformer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Rewrites existing test vector files to a different layout.
+ * @version 0.1
+ */
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <stdint.h>
+
+#include "TVTransformer.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Constructor
+ * @param _sourceSettings The settings the file to be transformed has been
+ *   written with.
+ * @param _targetSettings The settings of the file to be written.
+ */
+TVTransformer::TVTransformer(const TVFileSettings & _sourceSettings,
+		const TVFileSettings & _targetSettings) :
+		sourceSettings_(_sourceSettings), targetSettings_(_targetSettings),
+		threadCount_(1), chunkSize_(16384), keepComments_(true) {
+
+	const unsigned int cores = thread::hardware_concurrency();
+	threadCount_ = (cores > 0) ? cores : 1;
+	BuildSignalMap();
+}
+
+/**
+ * @brief Destructor
+ */
+TVTransformer::~TVTransformer() {
+}
+
+
+// ****************************************************************************
+// Getter/Setter
+// ****************************************************************************
+
+/**
+ * @brief Set the number of threads transforming the chunks.
+ * @param _threadCount The number of threads (at least one).
+ */
+void TVTransformer::SetThreadCount(const int _threadCount) {
+	if (_threadCount < 1) {
+		throw invalid_argument("The transformer requires at least one thread.");
+	}
+	threadCount_ = _threadCount;
+}
+
+/**
+ * @brief Set the number of lines processed as a single chunk.
+ * @param _chunkSize The number of lines per chunk (at least one).
+ */
+void TVTransformer::SetChunkSize(const size_t _chunkSize) {
+	if (_chunkSize < 1) {
+		throw invalid_argument("The transformer requires at least one line per "
+				"chunk.");
+	}
+	chunkSize_ = _chunkSize;
+}
+
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Look up every target signal in the source signal declarations.
+ */
+void TVTransformer::BuildSignalMap() {
+	const vector<SignalDeclaration> & sourceDecls = sourceSettings_.getTVDeclarations();
+	const vector<SignalDeclaration> & targetDecls = targetSettings_.getTVDeclarations();
+
+	signalMap_.clear();
+	for (size_t t = 0; t < targetDecls.size(); ++t) {
+		int source = -1;
+		for (size_t s = 0; s < sourceDecls.size() && source < 0; ++s) {
+			if (sourceDecls[s].GetName() == targetDecls[t].GetName()) {
+				source = s;
+			}
+		}
+		if (source < 0) {
+			throw invalid_argument("Signal '" + targetDecls[t].GetName() + "' is not "
+					"declared in the source test vector file settings.");
+		}
+		if (sourceDecls[source].GetWidth() != targetDecls[t].GetWidth()) {
+			throw invalid_argument("Signal '" + targetDecls[t].GetName() + "' has "
+					"different widths in the source and target settings.");
+		}
+		signalMap_.push_back(source);
+	}
+}
+
+/**
+ * @brief Transform a chunk of lines (called on a separate thread).
+ * @param _lines The lines of the chunk.
+ * @param _firstLine The line number of the first line within the source file.
+ * @param _result The transformed test vector lines.
+ * @param _error Set to the error message if a line could not be transformed.
+ */
+void TVTransformer::TransformChunk(const vector<string> & _lines,
+		const long long _firstLine, vector<TransformedLine> & _result,
+		string & _error) const {
+	vector<string> tokens;
+	TransformedLine transformed;
+
+	_result.clear();
+	for (size_t i = 0; i < _lines.size(); ++i) {
+		try {
+			if (TransformLine(_lines[i], tokens, transformed)) {
+				_result.push_back(transformed);
+			}
+		} catch (const exception & e) {
+			stringstream ssError;
+			ssError << "Line " << (_firstLine + i) << ": " << e.what();
+			_error = ssError.str();
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Transform a single line of the source file.
+ * @param _line The source line.
+ * @param _tokens Scratch space for the source values.
+ * @param _result The transformed test vector line.
+ * @return False if the line is not a test vector line (and hence dropped).
+ */
+bool TVTransformer::TransformLine(const string & _line, vector<string> & _tokens,
+		TransformedLine & _result) const {
+	const string & commentIndicator = sourceSettings_.getCommentIndicator();
+	const vector<SignalDeclaration> & sourceDecls = sourceSettings_.getTVDeclarations();
+	const vector<SignalDeclaration> & targetDecls = targetSettings_.getTVDeclarations();
+
+	// Skip empty lines as well as file headers, captions and comment lines.
+	const size_t start = _line.find_first_not_of(" \t\r");
+	if (start == string::npos || _line.compare(start, commentIndicator.length(),
+			commentIndicator) == 0) {
+		return false;
+	}
+
+	// Split off the line-end comment.
+	size_t end = _line.find(commentIndicator, start);
+	_result.comment.clear();
+	if (end != string::npos) {
+		if (keepComments_) {
+			size_t commentStart = end + commentIndicator.length();
+			if (commentStart < _line.length() && _line[commentStart] == ' ') {
+				commentStart++;
+			}
+			_result.comment = _line.substr(commentStart);
+		}
+	} else {
+		end = _line.length();
+	}
+
+	_tokens.clear();
+	size_t pos = start;
+	const size_t timeColumns = sourceSettings_.isEnableTimeColumn() ? 1 : 0;
+	while (pos < end) {
+		const size_t tokenEnd = min(_line.find_first_of(" \t\r", pos), end);
+		_tokens.push_back(_line.substr(pos, tokenEnd - pos));
+		pos = _line.find_first_not_of(" \t\r", tokenEnd);
+		if (pos == string::npos) {
+			break;
+		}
+	}
+	if (_tokens.size() != sourceDecls.size() + timeColumns) {
+		throw invalid_argument("Number of values does not match the number of "
+				"source signal declarations.");
+	}
+
+	_result.time = -1;
+	if (timeColumns > 0) {
+		if (_tokens[0].find_first_not_of("0123456789") != string::npos) {
+			throw invalid_argument("Invalid time '" + _tokens[0] + "'.");
+		}
+		_result.time = stoll(_tokens[0]);
+	}
+
+	_result.values.clear();
+	for (size_t t = 0; t < targetDecls.size(); ++t) {
+		const SignalDeclaration & sourceDecl = sourceDecls[signalMap_[t]];
+		if (t > 0) {
+			_result.values += ' ';
+		}
+		_result.values += ConvertValue(_tokens[signalMap_[t] + timeColumns],
+				sourceDecl.GetPrintBase(), targetDecls[t].GetPrintBase(),
+				targetDecls[t].GetWidth());
+	}
+	return true;
+}
+
+/**
+ * @brief Convert the digits of a single value from one base into another.
+ *
+ * Values consisting of don't care identifiers only are converted into the
+ * corresponding number of target don't care identifiers. Hexadecimal digits
+ * keep their case.
+ *
+ * @param _digits The digits of the value in the source base.
+ * @param _sourceBase The source number base.
+ * @param _targetBase The target number base.
+ * @param _width The width of the signal in bits.
+ * @return The digits of the value in the target base.
+ */
+string TVTransformer::ConvertValue(const string & _digits, const int _sourceBase,
+		const int _targetBase, const int _width) const {
+
+	if (_digits.find_first_not_of(sourceSettings_.getDontCareIdentifier()) ==
+			string::npos) {
+		return string(SignalDeclaration::DigitCount(_width, _targetBase),
+				targetSettings_.getDontCareIdentifier());
+	}
+	if (_sourceBase == _targetBase) {
+		return _digits;
+	}
+
+	// Accumulate the value in 32-bit limbs (least significant first).
+	vector<uint32_t> limbs(1, 0);
+	bool isUpperCase = false;
+	for (size_t i = 0; i < _digits.length(); ++i) {
+		const int digit = SignalDeclaration::DigitValue(_digits[i]);
+		if (digit < 0 || digit >= _sourceBase) {
+			throw invalid_argument("Invalid digit '" + _digits.substr(i, 1) +
+					"' in value '" + _digits + "'.");
+		}
+		isUpperCase |= (_digits[i] >= 'A' && _digits[i] <= 'Z');
+
+		uint64_t carry = digit;
+		for (size_t l = 0; l < limbs.size(); ++l) {
+			const uint64_t product = (uint64_t)limbs[l] * _sourceBase + carry;
+			limbs[l] = (uint32_t)product;
+			carry = product >> 32;
+		}
+		if (carry > 0) {
+			limbs.push_back((uint32_t)carry);
+		}
+	}
+
+	// Emit the digits of the target base by repeated division.
+	const char * digitChars = isUpperCase ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ" :
+			"0123456789abcdefghijklmnopqrstuvwxyz";
+	const int digitCount = SignalDeclaration::DigitCount(_width, _targetBase);
+	string result(digitCount, '0');
+	int pos = digitCount;
+	bool isZero = false;
+	while (!isZero) {
+		uint64_t remainder = 0;
+		isZero = true;
+		for (size_t l = limbs.size(); l-- > 0; ) {
+			const uint64_t current = (remainder << 32) | limbs[l];
+			limbs[l] = (uint32_t)(current / _targetBase);
+			remainder = current % _targetBase;
+			isZero &= (limbs[l] == 0);
+		}
+		if (pos == 0) {
+			throw invalid_argument("Value '" + _digits + "' exceeds the width of its "
+					"signal.");
+		}
+		result[--pos] = digitChars[remainder];
+	}
+	return result;
+}
+
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Transform a test vector file into the file given by the target
+ *   settings.
+ * @param _inputPath The path of the file to be transformed.
+ * @return The number of test vectors written.
+ */
+long long TVTransformer::Transform(const string & _inputPath) {
+	TVGenerator tvGenerator;
+	tvGenerator.Initialize(targetSettings_);
+	const long long count = Transform(_inputPath, tvGenerator);
+	tvGenerator.Finalize();
+	return count;
+}
+
+/**
+ * @copydoc TVTransformer::Transform(const string & _inputPath)
+ * @param _output The stream to which the transformed file should be written
+ *   instead of the file path of the target settings.
+ */
+long long TVTransformer::Transform(const string & _inputPath, ostream & _output) {
+	TVGenerator tvGenerator;
+	tvGenerator.Initialize(targetSettings_, _output);
+	const long long count = Transform(_inputPath, tvGenerator);
+	tvGenerator.Finalize();
+	return count;
+}
+
+/**
+ * @copydoc TVTransformer::Transform(const string & _inputPath)
+ * @param _tvGenerator An initialized (single file based) TVGenerator to which
+ *   the transformed test vectors should be written.
+ */
+long long TVTransformer::Transform(const string & _inputPath,
+		TVGenerator & _tvGenerator) {
+	ifstream input(_inputPath.c_str());
+	if (!input) {
+		throw runtime_error("Unable to open test vector file '" + _inputPath + "'.");
+	}
+
+	vector<vector<string> > chunks(threadCount_);
+	vector<vector<TransformedLine> > results(threadCount_);
+	vector<string> errors(threadCount_);
+	vector<long long> firstLines(threadCount_);
+	long long lineNumber = 1;
+	long long count = 0;
+	long long sourceTime = 0;       // Absolute time of the last test vector.
+
+	while (input) {
+		// Read one chunk per thread.
+		int chunkCount = 0;
+		for (; chunkCount < threadCount_ && input; ++chunkCount) {
+			vector<string> & chunk = chunks[chunkCount];
+			chunk.resize(chunkSize_);
+			firstLines[chunkCount] = lineNumber;
+			size_t lines = 0;
+			while (lines < chunkSize_ && getline(input, chunk[lines])) {
+				++lines;
+			}
+			chunk.resize(lines);
+			lineNumber += lines;
+		}
+
+		// Transform the chunks in parallel, the current thread takes the first.
+		vector<thread> workers;
+		for (int c = 1; c < chunkCount; ++c) {
+			workers.push_back(thread(&TVTransformer::TransformChunk, this,
+					cref(chunks[c]), firstLines[c], ref(results[c]), ref(errors[c])));
+		}
+		if (chunkCount > 0) {
+			TransformChunk(chunks[0], firstLines[0], results[0], errors[0]);
+		}
+		for (size_t w = 0; w < workers.size(); ++w) {
+			workers[w].join();
+		}
+
+		// Write the results in their original order.
+		for (int c = 0; c < chunkCount; ++c) {
+			if (!errors[c].empty()) {
+				throw runtime_error(_inputPath + ": " + errors[c]);
+			}
+			for (size_t i = 0; i < results[c].size(); ++i) {
+				const TransformedLine & line = results[c][i];
+				long long time = -1;
+				if (line.time >= 0) {
+					sourceTime = sourceSettings_.isEnableDeltaTime() ?
+							sourceTime + line.time : line.time;
+					if (targetSettings_.isEnableTimeColumn()) {
+						time = sourceTime;
+					}
+				}
+				_tvGenerator.WriteFormattedTestVectorLine(line.values, time,
+						line.comment);
+			}
+			count += results[c].size();
+		}
+	}
+	return count;
+}
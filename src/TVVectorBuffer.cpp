@@ -0,0 +1,307 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVVectorBuffer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief An in-memory store for test vectors awaiting their formatting.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+#include "TVVectorBuffer.h"
+
+using namespace std;
+
+// ****************************************************************************
+// Batch
+// ****************************************************************************
+
+/**
+ * @brief Default constructor, which creates an empty batch without capacity.
+ */
+TVVectorBuffer::Batch::Batch() : signalCount_(0), capacity_(0),
+		commentCapacity_(0), size_(0) {
+}
+
+/**
+ * @brief Allocate the batch and drop all of its test vectors.
+ *
+ * Every rendered slot reserves the number of digits of its signal, i.e.,
+ * rendering does not grow the batch afterwards. Calling it again with the
+ * same arguments reuses the existing allocations.
+ *
+ * @param _sigDecls The declarations of the signals of every test vector.
+ * @param _capacity The maximum number of test vectors.
+ * @param _commentCapacity The maximum number of bytes of all comments.
+ */
+void TVVectorBuffer::Batch::Reset(const vector<SignalDeclaration> & _sigDecls,
+		const size_t _capacity, const size_t _commentCapacity) {
+	signalCount_			= _sigDecls.size();
+	capacity_					= _capacity;
+	commentCapacity_	= _commentCapacity;
+
+	values_.resize(signalCount_ * _capacity);
+	rendered_.resize(signalCount_ * _capacity);
+	for (size_t i = 0; i < rendered_.size(); ++i) {
+		rendered_[i].reserve(_sigDecls[i / _capacity].GetDigitCount());
+	}
+	isDontCare_.resize(signalCount_ * _capacity);
+	times_.resize(_capacity);
+	commentArena_.reserve(_commentCapacity);
+	commentEnds_.resize(_capacity);
+	Clear();
+}
+
+/**
+ * @brief Get the comment of a test vector.
+ * @param _row The index of the test vector within the batch.
+ * @return The comment (referencing the arena, i.e., valid until the batch is
+ *   modified).
+ */
+TVStringView TVVectorBuffer::Batch::GetComment(const size_t _row) const {
+	const size_t begin = (_row == 0) ? 0 : commentEnds_[_row - 1];
+	return TVStringView(commentArena_.data() + begin, commentEnds_[_row] - begin);
+}
+
+/**
+ * @brief Append a test vector to the batch.
+ *
+ * The batch has to be written and cleared first if CanAppend() returns false
+ * for the comment.
+ *
+ * @param _signalValues The values of the signals (one per column).
+ * @param _time The value of the time column (as it should be written).
+ * @param _comment The comment of the test vector.
+ */
+void TVVectorBuffer::Batch::Append(const vector<StdLogicVector> & _signalValues,
+		const long long _time, const TVStringView & _comment) {
+	if (!CanAppend(_comment)) {
+		throw logic_error("Bad function call: The vector buffer is full.");
+	}
+	for (size_t sig = 0; sig < signalCount_; ++sig) {
+		values_[sig * capacity_ + size_] = _signalValues[sig];
+	}
+	times_[size_] = _time;
+	commentArena_.append(_comment.data(), _comment.size());
+	commentEnds_[size_] = commentArena_.size();
+	size_++;
+}
+
+/**
+ * @brief Render all values in the print bases of their signals (column by
+ *   column, i.e., with the same print base and width for a whole run of
+ *   adjacent values).
+ * @param _sigDecls The signal declarations of the values.
+ * @param _dontCareIdentifier The character replacing don't care values.
+ */
+void TVVectorBuffer::Batch::Render(const vector<SignalDeclaration> & _sigDecls,
+		const char _dontCareIdentifier) {
+	for (size_t sig = 0; sig < signalCount_; ++sig) {
+		const int printBase = _sigDecls[sig].GetPrintBase();
+		const size_t columnEnd = sig * capacity_ + size_;
+		for (size_t i = sig * capacity_; i < columnEnd; ++i) {
+			// Copy into the reserved slot (moving would drop its reservation).
+			const string digits = values_[i].ToString(printBase, true);
+			rendered_[i].assign(digits);
+			isDontCare_[i] = values_[i].isDontCare();
+			if (isDontCare_[i]) {
+				rendered_[i].assign(rendered_[i].length(), _dontCareIdentifier);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Drop all test vectors (keeping the allocations).
+ */
+void TVVectorBuffer::Batch::Clear() {
+	commentArena_.clear();
+	size_ = 0;
+}
+
+// ****************************************************************************
+// Constructors/Destructors
+// ****************************************************************************
+
+/**
+ * @brief Default constructor, which creates a disabled buffer.
+ */
+TVVectorBuffer::TVVectorBuffer() : filling_(&batches_[0]), pending_(&batches_[1]),
+		capacity_(0), isBackground_(false), hasJob_(false), stop_(false),
+		jobTVCount_(0) {
+}
+
+/**
+ * @brief Destructor, which waits for the batch being written (if any). The
+ *   test vectors of the batch being filled are discarded.
+ */
+TVVectorBuffer::~TVVectorBuffer() {
+	StopWorker();
+}
+
+// ****************************************************************************
+// Utility functions
+// ****************************************************************************
+
+/**
+ * @brief Body of the worker thread: write the dispatched batches until the
+ *   buffer is stopped.
+ */
+void TVVectorBuffer::RunWorker() {
+	unique_lock<mutex> lock(mutex_);
+	for (;;) {
+		while (!hasJob_ && !stop_) {
+			cond_.wait(lock);
+		}
+		if (!hasJob_) {
+			return;
+		}
+
+		lock.unlock();
+		exception_ptr error;
+		try {
+			writer_(*pending_, jobTVCount_);
+		} catch (...) {
+			error = current_exception();
+		}
+		pending_->Clear();
+		lock.lock();
+
+		if (error && !error_) {
+			error_ = error;
+		}
+		hasJob_ = false;
+		cond_.notify_all();
+	}
+}
+
+/**
+ * @brief Let the worker thread (if any) finish its batch and terminate.
+ */
+void TVVectorBuffer::StopWorker() {
+	if (!worker_.joinable()) {
+		return;
+	}
+	{
+		lock_guard<mutex> lock(mutex_);
+		stop_ = true;
+	}
+	cond_.notify_all();
+	worker_.join();
+	stop_ = false;
+}
+
+// ****************************************************************************
+// Public methods
+// ****************************************************************************
+
+/**
+ * @brief Allocate the buffer and drop all buffered test vectors.
+ *
+ * Waits for the batch being written first. Calling it again with the same
+ * arguments reuses the existing allocations (and worker thread).
+ *
+ * @param _sigDecls The declarations of the signals of every test vector.
+ * @param _capacity The maximum number of test vectors per batch (0 disables
+ *   the buffer).
+ * @param _commentCapacity The maximum number of bytes of all comments of a
+ *   batch.
+ * @param _isBackground Whether the batches are written by a worker thread
+ *   (or by the thread dispatching them).
+ * @param _writer The function formatting and writing a batch.
+ */
+void TVVectorBuffer::Reset(const vector<SignalDeclaration> & _sigDecls,
+		const size_t _capacity, const size_t _commentCapacity,
+		const bool _isBackground, const Writer & _writer) {
+	Wait();
+	if (!_isBackground || _capacity == 0) {
+		StopWorker();
+	}
+
+	capacity_			= _capacity;
+	isBackground_	= _isBackground && _capacity > 0;
+	writer_				= _writer;
+	batches_[0].Reset(_sigDecls, _capacity, _commentCapacity);
+	batches_[1].Reset(_sigDecls, _capacity, _commentCapacity);
+
+	if (isBackground_ && !worker_.joinable()) {
+		worker_ = thread(&TVVectorBuffer::RunWorker, this);
+	}
+}
+
+/**
+ * @brief Hand the filled batch over to the writer and continue with the
+ *   other one.
+ *
+ * Waits for the previously dispatched batch only. In background mode, the
+ * batch is written by the worker thread, otherwise right away.
+ *
+ * @param _tvCount The number of test vectors of the file incl. the buffered
+ *   ones.
+ */
+void TVVectorBuffer::Dispatch(const int _tvCount) {
+	if (filling_->IsEmpty()) {
+		return;
+	}
+	Wait();
+	swap(filling_, pending_);
+
+	if (!isBackground_) {
+		try {
+			writer_(*pending_, _tvCount);
+		} catch (...) {
+			pending_->Clear();
+			throw;
+		}
+		pending_->Clear();
+		return;
+	}
+
+	{
+		lock_guard<mutex> lock(mutex_);
+		jobTVCount_	= _tvCount;
+		hasJob_			= true;
+	}
+	cond_.notify_all();
+}
+
+/**
+ * @brief Wait until the dispatched batch has been written.
+ *
+ * An error raised while writing a batch on the worker thread is rethrown
+ * here (once).
+ */
+void TVVectorBuffer::Wait() {
+	unique_lock<mutex> lock(mutex_);
+	while (hasJob_) {
+		cond_.wait(lock);
+	}
+	if (error_) {
+		exception_ptr error = error_;
+		error_ = exception_ptr();
+		rethrow_exception(error);
+	}
+}
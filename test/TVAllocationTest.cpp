@@ -0,0 +1,158 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVAllocationTest.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Tests that writing lines and comments does not allocate.
+ * @version 0.1
+ */
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "TVGenerator.h"
+#include "TVTest.h"
+
+using namespace std;
+
+/** Number of heap allocations of the test program so far. */
+static long allocationCount = 0;
+
+void * operator new(size_t _size) {
+	allocationCount++;
+	void * memory = malloc(_size ? _size : 1);
+	if (!memory) {
+		throw bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void * _memory) noexcept {
+	free(_memory);
+}
+
+void operator delete(void * _memory, size_t) noexcept {
+	free(_memory);
+}
+
+int main() {
+	// Comments and lines exceed the small string buffer of std::string, i.e.,
+	// any temporary string copy would allocate.
+	const string comment = "a comment exceeding the small string buffer";
+	const string line = "an arbitrary line exceeding the small string buffer";
+
+	TVFileSettings settings("TVAllocationTest.tv", "author", "content", "project");
+	settings.AddSignal(SignalDeclaration("a", 8));
+	settings.AddSignal(SignalDeclaration("b", 4, 2));
+	settings.enableLineEndComments(true);
+
+	TVGenerator generator;
+	generator.Initialize(settings);
+	vector<StdLogicVector> values;
+	values.push_back(StdLogicVector(8, 3));
+	values.push_back(StdLogicVector(4, 1));
+
+	// Warm up the stream buffers and the rendered signal caption.
+	for (int i = 0; i < 100; ++i) {
+		generator.WriteTestVectorLine(values, comment);
+		generator.WriteTVCommentLine(comment);
+	}
+	TV_CHECK(allocationCount > 0);  // The counting operator new is in use.
+
+	long allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		generator.WriteTVCommentLine(comment);
+		generator.WriteTVCommentLine("a C string comment exceeding the small string buffer");
+	}
+	TV_CHECK(allocationCount == allocationsBefore);
+
+	allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		generator.WriteArbitraryTVLine(line);
+		generator.WriteArbitraryTVLine(line, comment);
+	}
+	TV_CHECK(allocationCount == allocationsBefore);
+
+	allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		generator.WriteFormattedTestVectorLine("03 1", comment);
+	}
+	TV_CHECK(allocationCount == allocationsBefore);
+
+	allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		generator.WriteTestVectorLine(values, comment);
+	}
+	TV_CHECK(allocationCount == allocationsBefore);
+
+	// Values exceeding the small string buffer are rendered without any
+	// allocation besides the string returned by StdLogicVector::ToString().
+	TVFileSettings wideSettings("TVAllocationTest_wide.tv", "author", "content",
+			"project");
+	wideSettings.AddSignal(SignalDeclaration("c", 64, 2));
+	wideSettings.AddSignal(SignalDeclaration("d", 60, 8));
+	wideSettings.enableLineEndComments(true);
+
+	TVGenerator wideGenerator;
+	wideGenerator.Initialize(wideSettings);
+	vector<StdLogicVector> wideValues;
+	wideValues.push_back(StdLogicVector(64, 0x0123456789abcdefULL));
+	wideValues.push_back(StdLogicVector(60, 0x0fedcba987654321ULL));
+	for (int i = 0; i < 100; ++i) {
+		wideGenerator.WriteTestVectorLine(wideValues, comment);
+	}
+
+	allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		wideValues[0].ToString(2, true);
+		wideValues[1].ToString(8, true);
+	}
+	const long renderAllocations = allocationCount - allocationsBefore;
+	TV_CHECK(renderAllocations > 0);  // The values exceed the small string buffer.
+
+	allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		wideGenerator.WriteTestVectorLine(wideValues, comment);
+	}
+	TV_CHECK(allocationCount - allocationsBefore == renderAllocations);
+
+	// The strict validation renders the values, which are not rendered again.
+	wideGenerator.SetValidationPolicy(kValidateStrict);
+	allocationsBefore = allocationCount;
+	for (int i = 0; i < 1000; ++i) {
+		wideGenerator.WriteTestVectorLine(wideValues, comment);
+	}
+	TV_CHECK(allocationCount - allocationsBefore == renderAllocations);
+	wideGenerator.Finalize();
+
+	// Temporary and constant values are accepted as well (and copied).
+	const vector<StdLogicVector> constValues(values);
+	TV_CHECK(generator.WriteTestVectorLine(constValues, comment) == 0);
+	TV_CHECK(generator.WriteTestVectorLine(vector<StdLogicVector>(values),
+			comment) == 0);
+	TV_CHECK(generator.GetTVCount() == 2102);
+
+	generator.Finalize();
+	return TestResult();
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+
+/**
+ * @file TVCheckpointTest.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Tests resuming a test vector file after a crash.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "TVGenerator.h"
+#include "TVTest.h"
+
+using namespace std;
+
+/** Number of test vectors of the complete file. */
+static const int kVectorCount = 80;
+
+/** Number of test vectors written before the crash. */
+static const int kCrashCount = 57;
+
+/**
+ * @brief Write the test vectors of the given range.
+ */
+static void WriteVectors(TVGenerator & _generator, const int _first,
+		const int _last) {
+	for (int i = _first; i < _last; ++i) {
+		vector<StdLogicVector> values(1, StdLogicVector(8, i));
+		_generator.WriteTestVectorLine(values, 10 + 3 * i, "");
+	}
+}
+
+/**
+ * @brief Read a whole file.
+ */
+static string ReadFile(const string & _filePath) {
+	ifstream file(_filePath.c_str());
+	return string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+int main() {
+	TVFileSettings settings("TVCheckpointTest.tv", "author", "content", "project");
+	settings.AddSignal(SignalDeclaration("a", 8));
+	settings.setTimeColumn("time", 4, true);
+	settings.enableReproducibleHeader(true);
+	settings.enableContentHash(true);
+
+	// Uninterrupted run.
+	TVFileSettings referenceSettings = settings;
+	referenceSettings.setFilePath("TVCheckpointTest_reference.tv");
+	TVGenerator reference;
+	reference.Initialize(referenceSettings);
+	WriteVectors(reference, 0, kVectorCount);
+	reference.Finalize();
+
+	// The child crashes after the last checkpoint.
+	const pid_t child = fork();
+	TV_CHECK(child >= 0);
+	if (child == 0) {
+		TVGenerator generator;
+		generator.EnableCheckpoints("TVCheckpointTest.ckpt", 10);
+		generator.Initialize(settings);
+		WriteVectors(generator, 0, kCrashCount);
+		_Exit(0);
+	}
+	int status = 0;
+	TV_CHECK(waitpid(child, &status, 0) == child && WIFEXITED(status));
+	TV_CHECK(ReadVectorLines(settings.getFilePath(),
+			settings.getCommentIndicator()).size() >= 50);
+
+	// Test vectors written after the last checkpoint may have reached the file
+	// (partially), unless the buffers of the child held them back.
+	{
+		ofstream file(settings.getFilePath().c_str(), ios::app);
+		file << "0003 32\n0003 3";
+	}
+
+	// Resuming continues behind the last checkpoint and results in the same
+	// file and content hash as the uninterrupted run.
+	TVGenerator generator;
+	generator.EnableCheckpoints("TVCheckpointTest.ckpt", 10);
+	const int resumed = generator.Resume(settings);
+	TV_CHECK(resumed == 50);
+	WriteVectors(generator, resumed, kVectorCount);
+	generator.Finalize();
+	TV_CHECK(ReadFile(settings.getFilePath()) ==
+			ReadFile(referenceSettings.getFilePath()));
+	TV_CHECK(generator.GetContentHash() == reference.GetContentHash());
+
+	// Streams cannot be checkpointed, which is detected before the header is
+	// written.
+	ostringstream stream;
+	TVGenerator streamGenerator;
+	streamGenerator.EnableCheckpoints("TVCheckpointTest.ckpt", 10);
+	bool isRejected = false;
+	try {
+		streamGenerator.Initialize(settings, stream);
+	} catch (const logic_error &) {
+		isRejected = true;
+	}
+	TV_CHECK(isRejected);
+	TV_CHECK(stream.str().empty());
+
+	return TestResult();
+}
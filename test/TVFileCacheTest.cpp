@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+
+/**
+ * @file TVFileCacheTest.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Tests the test vector file cache using hard links.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "TVFileCache.h"
+#include "TVGenerator.h"
+#include "TVTest.h"
+
+using namespace std;
+
+/**
+ * @brief Generate a test vector file and return its content hash.
+ */
+static uint64_t Generate(const TVFileSettings & _settings, const int _offset) {
+	TVGenerator generator;
+	generator.Initialize(_settings);
+	for (int i = 0; i < 50; ++i) {
+		vector<StdLogicVector> values(1, StdLogicVector(8, i + _offset));
+		generator.WriteTestVectorLine(values, "");
+	}
+	generator.Finalize();
+	return generator.GetContentHash();
+}
+
+/**
+ * @brief Read a whole file.
+ */
+static string ReadFile(const string & _filePath) {
+	ifstream file(_filePath.c_str());
+	return string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Get the number of hard links of a file (0 if it does not exist).
+ */
+static nlink_t GetLinkCount(const string & _filePath) {
+	struct stat st;
+	return stat(_filePath.c_str(), &st) == 0 ? st.st_nlink : 0;
+}
+
+int main() {
+	TVFileCache cache("TVFileCacheTest.cache");
+	cache.SetUseHardLinks(true);
+
+	TVFileSettings settings("TVFileCacheTest.tv", "author", "content", "project");
+	settings.AddSignal(SignalDeclaration("a", 8));
+	settings.enableReproducibleHeader(true);
+	settings.enableContentHash(true);
+
+	// Store a file and serve it at another path as a hard link.
+	cache.Store(settings, "seed=1", Generate(settings, 0));
+	const string stored = ReadFile(settings.getFilePath());
+
+	TVFileSettings otherSettings = settings;
+	otherSettings.setFilePath("TVFileCacheTest_other.tv");
+	TV_CHECK(cache.Fetch(otherSettings, "seed=1"));
+	TV_CHECK(ReadFile(otherSettings.getFilePath()) == stored);
+	const string entryPath = cache.GetDirectory() + "/" +
+			TVFileCache::ComputeKey(settings, "seed=1") + ".tv";
+	TV_CHECK(GetLinkCount(entryPath) == 3);
+
+	// A miss removes the linked file, so generating it does not write through
+	// to the cache entry.
+	TV_CHECK(!cache.Fetch(otherSettings, "seed=2"));
+	TV_CHECK(GetLinkCount(otherSettings.getFilePath()) == 0);
+	Generate(otherSettings, 7);
+	TV_CHECK(ReadFile(otherSettings.getFilePath()) != stored);
+	TV_CHECK(ReadFile(entryPath) == stored);
+	TV_CHECK(cache.Fetch(otherSettings, "seed=1"));
+	TV_CHECK(ReadFile(otherSettings.getFilePath()) == stored);
+
+	// A damaged entry is not served.
+	unlink(settings.getFilePath().c_str());
+	unlink(otherSettings.getFilePath().c_str());
+	{
+		ofstream entry(entryPath.c_str(), ios::app);
+		entry << "damaged\n";
+	}
+	TV_CHECK(!cache.Fetch(otherSettings, "seed=1"));
+	TV_CHECK(GetLinkCount(otherSettings.getFilePath()) == 0);
+
+	return TestResult();
+}
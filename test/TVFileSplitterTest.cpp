@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVFileSplitterTest.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Tests splitting, merging and transforming files with a time column.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+
+#include "TVFileSplitter.h"
+#include "TVGenerator.h"
+#include "TVTransformer.h"
+#include "TVTest.h"
+
+using namespace std;
+
+/**
+ * @brief Read a whole file.
+ */
+static string ReadFile(const string & _filePath) {
+	ifstream file(_filePath.c_str());
+	return string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+int main() {
+	for (int isDelta = 0; isDelta < 2; ++isDelta) {
+		TVFileSettings settings("TVFileSplitterTest.tv", "author", "content",
+				"project");
+		settings.AddSignal(SignalDeclaration("a", 8));
+		settings.AddSignal(SignalDeclaration("b", 4, 2));
+		settings.setTimeColumn("time", 4, isDelta);
+
+		TVGenerator generator;
+		generator.Initialize(settings);
+		vector<StdLogicVector> values(2, StdLogicVector(4, 1));
+		for (int i = 0; i < 100; ++i) {
+			values[0] = StdLogicVector(8, i);
+			generator.WriteTestVectorLine(values, 10 + i * 3, "");
+		}
+		generator.Finalize();
+		const vector<string> lines = ReadVectorLines("TVFileSplitterTest.tv",
+				settings.getCommentIndicator());
+
+		// Every shard starts with the absolute time of its first test vector,
+		// merging the shards restores the original file.
+		TVFileSplitter splitter(settings);
+		splitter.SetThreadCount(3);
+		const vector<string> shards = splitter.SplitByVectorCount(
+				"TVFileSplitterTest.tv", "TVFileSplitterTest_", 30);
+		TV_CHECK(shards.size() == 4);
+		TV_CHECK(ReadVectorLines(shards[1], settings.getCommentIndicator())[0] ==
+				"0100 1e 0001");
+		TV_CHECK(splitter.Merge(shards, "TVFileSplitterTest_merged.tv") == 100);
+		TV_CHECK(ReadVectorLines("TVFileSplitterTest_merged.tv",
+				settings.getCommentIndicator()) == lines);
+
+		// Transforming into the other time encoding and back is lossless.
+		TVFileSettings otherSettings = settings;
+		otherSettings.setFilePath("TVFileSplitterTest_other.tv");
+		otherSettings.setTimeColumn("time", 4, !isDelta);
+		TVTransformer(settings, otherSettings).Transform("TVFileSplitterTest.tv");
+		TVFileSettings backSettings = settings;
+		backSettings.setFilePath("TVFileSplitterTest_back.tv");
+		TVTransformer(otherSettings, backSettings).Transform(
+				"TVFileSplitterTest_other.tv");
+		TV_CHECK(ReadVectorLines("TVFileSplitterTest_back.tv",
+				settings.getCommentIndicator()) == lines);
+	}
+
+	// Test vectors passed on as formatted lines (transforming, splitting and
+	// merging) are accounted for in the toggle coverage like the original ones.
+	{
+		TVFileSettings settings("TVFileSplitterTest_coverage.tv", "author",
+				"content", "project");
+		settings.AddSignal(SignalDeclaration("a", 8));
+		settings.AddSignal(SignalDeclaration("b", 20, 2));
+		settings.enableReproducibleHeader(true);
+		settings.enableToggleCoverage(true);
+
+		TVGenerator generator;
+		generator.Initialize(settings);
+		vector<StdLogicVector> values(2);
+		for (int i = 0; i < 100; ++i) {
+			values[0] = StdLogicVector(8, i * 37);
+			values[1] = StdLogicVector(20, i * i);
+			generator.WriteTestVectorLine(values, "");
+		}
+		generator.Finalize();
+		const string original = ReadFile(settings.getFilePath());
+
+		TVFileSettings transformedSettings = settings;
+		transformedSettings.setFilePath("TVFileSplitterTest_transformed.tv");
+		TVTransformer(settings, transformedSettings).Transform(
+				settings.getFilePath());
+		TV_CHECK(ReadFile(transformedSettings.getFilePath()) == original);
+
+		TVFileSplitter splitter(settings);
+		const vector<string> shards = splitter.SplitByVectorCount(
+				settings.getFilePath(), "TVFileSplitterTest_coverage_", 30);
+		TV_CHECK(splitter.Merge(shards, "TVFileSplitterTest_merged.tv") == 100);
+		TV_CHECK(ReadFile("TVFileSplitterTest_merged.tv") == original);
+	}
+	return TestResult();
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+
+/**
+ * @file TVPipeBufferTest.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Tests the file descriptor sink on an anonymous pipe.
+ * @version 0.1
+ */
+
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "TVGenerator.h"
+#include "TVPipeBuffer.h"
+#include "TVTest.h"
+
+using namespace std;
+
+static long long fakeNowMs = 0;
+
+/**
+ * @brief Clock controlled by the test, so the latency checks do not depend on
+ *   the scheduling of the background thread.
+ */
+static long long FakeNowMs() {
+	return fakeNowMs;
+}
+
+/**
+ * @brief Read everything currently available from a non-blocking descriptor.
+ */
+static string ReadAvailable(const int _fd) {
+	string data;
+	char chunk[4096];
+	ssize_t length;
+	while ((length = read(_fd, chunk, sizeof(chunk))) > 0) {
+		data.append(chunk, length);
+	}
+	return data;
+}
+
+int main() {
+	int fds[2];
+	TV_CHECK(pipe(fds) == 0);
+	fcntl(fds[0], F_SETFL, O_NONBLOCK);
+
+	// Buffered data reaches the reader within the maximum latency, even if
+	// nothing else is written in the meantime, but not earlier than needed.
+	{
+		TVPipeBuffer pipeBuffer(fds[1], 10, FakeNowMs);
+		ostream pipeStream(&pipeBuffer);
+		pipeStream << "0123 4" << '\n';
+		pipeBuffer.FlushExpired();
+		TV_CHECK(ReadAvailable(fds[0]).empty());
+		fakeNowMs += 4;
+		pipeBuffer.FlushExpired();
+		TV_CHECK(ReadAvailable(fds[0]).empty());
+		fakeNowMs += 1;
+		pipeBuffer.FlushExpired();
+		TV_CHECK(ReadAvailable(fds[0]) == "0123 4\n");
+
+		// Data is aged from the last check without pending data.
+		fakeNowMs += 100;
+		pipeBuffer.FlushExpired();
+		pipeStream << "5678 9\n";
+		fakeNowMs += 4;
+		pipeBuffer.FlushExpired();
+		TV_CHECK(ReadAvailable(fds[0]).empty());
+		fakeNowMs += 1;
+		pipeBuffer.FlushExpired();
+		TV_CHECK(ReadAvailable(fds[0]) == "5678 9\n");
+	}
+
+	// Without a latency limit, data is only written when the buffer is full or
+	// the stream is flushed.
+	{
+		TVPipeBuffer pipeBuffer(fds[1], -1, FakeNowMs);
+		ostream pipeStream(&pipeBuffer);
+		pipeStream << "line\n";
+		fakeNowMs += 1000;
+		pipeBuffer.FlushExpired();
+		TV_CHECK(ReadAvailable(fds[0]).empty());
+		pipeStream.flush();
+		TV_CHECK(ReadAvailable(fds[0]) == "line\n");
+	}
+
+	// The generator's output arrives unchanged in chunks.
+	{
+		TVFileSettings settings("pipe_reference.tv", "test", "pipe buffer test",
+				"TVGenerator");
+		settings.AddSignal(SignalDeclaration("data", 12));
+		settings.enableReproducibleHeader(true);
+		string expected;
+		{
+			TVGenerator tvGenerator;
+			tvGenerator.Initialize(settings);
+			for (int i = 0; i < 2000; ++i) {
+				vector<StdLogicVector> values(1, StdLogicVector(12, i));
+				tvGenerator.WriteTestVectorLine(values, "");
+			}
+			tvGenerator.Finalize();
+			ifstream file("pipe_reference.tv");
+			expected.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+		}
+
+		TVPipeBuffer pipeBuffer(fds[1], 10, FakeNowMs);
+		ostream pipeStream(&pipeBuffer);
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(settings, pipeStream);
+		string received;
+		for (int i = 0; i < 2000; ++i) {
+			vector<StdLogicVector> values(1, StdLogicVector(12, i));
+			tvGenerator.WriteTestVectorLine(values, "");
+			received += ReadAvailable(fds[0]);
+		}
+		tvGenerator.Finalize();
+		received += ReadAvailable(fds[0]);
+		TV_CHECK(received == expected);
+	}
+
+	// Once the reader has gone away (detected by a latency flush), the stream
+	// goes bad.
+	close(fds[0]);
+	{
+		TVPipeBuffer pipeBuffer(fds[1], 10, FakeNowMs);
+		ostream pipeStream(&pipeBuffer);
+		pipeStream << "lost\n";
+		fakeNowMs += 10;
+		pipeBuffer.FlushExpired();
+		TV_CHECK(pipeBuffer.IsBroken());
+		pipeStream << "0123 4\n";
+		TV_CHECK(!pipeStream.good());
+	}
+	close(fds[1]);
+
+	return TestResult();
+}
@@ -0,0 +1,212 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVRingBufferTest.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Tests the shared-memory ring buffer sink with a stand-in consumer.
+ * @version 0.1
+ *
+ * The consumer (TVStubConsumer) runs as a separate process pulling the test
+ * vectors via tvring_open()/tvring_next_vector(). Its output has to match the
+ * test vectors of a file written by the TVGenerator with the same settings.
+ */
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "TVGenerator.h"
+#include "TVRingBuffer.h"
+#include "TVTest.h"
+
+using namespace std;
+
+static const string kRingName = "/tvring_test";
+
+/**
+ * @brief Start the stand-in consumer.
+ * @param _outputPath The file the consumer writes the test vectors to.
+ * @param _count The number of test vectors after which the consumer exits
+ *   without closing the ring (empty to read all of them).
+ * @return The process id of the consumer.
+ */
+static pid_t StartConsumer(const string & _outputPath, const string & _count) {
+	const pid_t pid = fork();
+	if (pid == 0) {
+		if (_count.empty()) {
+			execl("./TVStubConsumer", "TVStubConsumer", kRingName.c_str(), "%",
+					_outputPath.c_str(), (char *)NULL);
+		} else {
+			execl("./TVStubConsumer", "TVStubConsumer", kRingName.c_str(), "%",
+					_outputPath.c_str(), _count.c_str(), (char *)NULL);
+		}
+		_exit(127);
+	}
+	return pid;
+}
+
+/**
+ * @brief Map the ring segment (as a consumer would, without attaching).
+ */
+static TVRingHeader * MapRing() {
+	const int fd = shm_open(kRingName.c_str(), O_RDONLY, 0);
+	struct stat st;
+	fstat(fd, &st);
+	void * map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	return static_cast<TVRingHeader *>(map);
+}
+
+/**
+ * @brief Get the number of bytes published to the ring so far.
+ */
+static uint64_t PublishedBytes() {
+	TVRingHeader * header = MapRing();
+	const uint64_t head = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+	munmap(header, sizeof(TVRingHeader) + header->capacity);
+	return head;
+}
+
+/**
+ * @brief Get the data published to the ring so far (which must not have
+ *   wrapped around).
+ */
+static string PublishedData() {
+	TVRingHeader * header = MapRing();
+	const uint64_t head = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+	const string data(reinterpret_cast<const char *>(header + 1), head);
+	munmap(header, sizeof(TVRingHeader) + header->capacity);
+	return data;
+}
+
+/**
+ * @brief Write test vectors using the provided generator.
+ * @param _tvGenerator The initialized generator.
+ * @param _count The number of test vectors to be written.
+ */
+static void WriteVectors(TVGenerator & _tvGenerator, const int _count) {
+	for (int i = 0; i < _count; ++i) {
+		vector<StdLogicVector> values;
+		values.push_back(StdLogicVector(16, (i * 40503) & 0xffff));
+		values.push_back(StdLogicVector(4, i & 0xf));
+		_tvGenerator.WriteTestVectorLine(values, (i % 10 == 0) ? "tenth" : "");
+	}
+}
+
+/**
+ * @brief Create the settings of the test vector file/ring.
+ */
+static TVFileSettings CreateSettings(const string & _filePath) {
+	TVFileSettings settings(_filePath, "test", "ring buffer test", "TVGenerator");
+	settings.AddSignal(SignalDeclaration("data", 16));
+	settings.AddSignal(SignalDeclaration("ctrl", 4, 2));
+	settings.enableLineEndComments(true);
+	return settings;
+}
+
+int main() {
+	const int vectorCount = 20000;
+
+	// Reference file.
+	{
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(CreateSettings("ring_reference.tv"));
+		WriteVectors(tvGenerator, vectorCount);
+		tvGenerator.Finalize();
+	}
+
+	// The consumer has to keep up with a ring much smaller than the data.
+	{
+		TVRingBuffer ring(kRingName, 4096);
+		const pid_t consumer = StartConsumer("ring_consumed.tv", "");
+		ostream ringStream(&ring);
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(CreateSettings("ring"), ringStream);
+		WriteVectors(tvGenerator, vectorCount);
+		tvGenerator.Finalize();
+		ring.Close();
+		TV_CHECK(ringStream.good());
+
+		int status = 0;
+		waitpid(consumer, &status, 0);
+		TV_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+		const vector<string> expected = ReadVectorLines("ring_reference.tv", "%");
+		TV_CHECK((int)expected.size() == vectorCount);
+		TV_CHECK(ReadVectorLines("ring_consumed.tv", "%") == expected);
+	}
+
+	// Every complete line is published right away (no flush required), with a
+	// threshold only once enough bytes are pending.
+	{
+		TVRingBuffer ring(kRingName, 1 << 16);
+		ostream ringStream(&ring);
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(CreateSettings("ring"), ringStream);
+		WriteVectors(tvGenerator, 1);
+		TV_CHECK(PublishedBytes() > 0 && PublishedData().back() == '\n');
+		const uint64_t published = PublishedBytes();
+
+		ring.SetPublishThreshold(1024);
+		WriteVectors(tvGenerator, 2);
+		TV_CHECK(PublishedBytes() == published);
+		WriteVectors(tvGenerator, 100);
+		TV_CHECK(PublishedBytes() > published && PublishedData().back() == '\n');
+	}
+
+	// A consumer which never attaches makes the write fail after the timeout.
+	{
+		TVRingBuffer ring(kRingName, 4096);
+		ring.SetTimeout(100);
+		ostream ringStream(&ring);
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(CreateSettings("ring"), ringStream);
+		WriteVectors(tvGenerator, 1000);
+		ringStream.flush();
+		TV_CHECK(ring.IsBroken());
+		TV_CHECK(!ringStream.good());
+	}
+
+	// A consumer which died is detected without waiting for the timeout.
+	{
+		TVRingBuffer ring(kRingName, 4096);
+		ring.SetTimeout(60000);
+		const pid_t consumer = StartConsumer("ring_crashed.tv", "10");
+		ostream ringStream(&ring);
+		TVGenerator tvGenerator;
+		tvGenerator.Initialize(CreateSettings("ring"), ringStream);
+		WriteVectors(tvGenerator, 10);
+		ringStream.flush();
+		int status = 0;
+		waitpid(consumer, &status, 0);
+		WriteVectors(tvGenerator, 1000);
+		ringStream.flush();
+		TV_CHECK(ring.IsBroken());
+		TV_CHECK(!ringStream.good());
+	}
+
+	return TestResult();
+}
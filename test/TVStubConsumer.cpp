@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVStubConsumer.cpp
+ * @author agent
+ * @date 18 October 2026
+ * @brief Stand-in for a simulator consuming test vectors from a ring buffer.
+ * @version 0.1
+ *
+ * Pulls all test vectors out of a TVRingBuffer using the C interface a test
+ * bench would call via DPI-C and writes them (one per line) to a file.
+ *
+ * Usage: TVStubConsumer <ring name> <comment indicator> <output file>
+ *        [<number of vectors to read before exiting without closing the ring>]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <time.h>
+
+#include "TVRingConsumer.h"
+
+int main(int argc, char * argv[]) {
+	if (argc < 4) {
+		fprintf(stderr, "Usage: %s <ring> <comment indicator> <output> [<count>]\n",
+				argv[0]);
+		return 2;
+	}
+	const long maxCount = (argc > 4) ? atol(argv[4]) : -1;
+
+	// The producer might not have created the ring yet.
+	tvring_t * ring = NULL;
+	for (int i = 0; i < 1000 && ring == NULL; ++i) {
+		ring = tvring_open(argv[1]);
+		if (ring == NULL) {
+			struct timespec ts = { 0, 1000000 };
+			nanosleep(&ts, NULL);
+		}
+	}
+	if (ring == NULL) {
+		fprintf(stderr, "Unable to open ring '%s'.\n", argv[1]);
+		return 1;
+	}
+
+	FILE * output = fopen(argv[3], "w");
+	if (output == NULL) {
+		fprintf(stderr, "Unable to open '%s'.\n", argv[3]);
+		return 1;
+	}
+	const char * line;
+	long count = 0;
+	while ((line = tvring_next_vector(ring, argv[2])) != NULL) {
+		fprintf(output, "%s\n", line);
+		if (++count == maxCount) {
+			// Simulate a crashed simulator.
+			fclose(output);
+			_Exit(0);
+		}
+	}
+	fclose(output);
+	const int error = tvring_error(ring);
+	tvring_close(ring);
+	return error ? 1 : 0;
+}
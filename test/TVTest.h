@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * A test vector file generator for hardware designs.
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *****************************************************************************/
+
+/**
+ * @file TVTest.h
+ * @author agent
+ * @date 18 October 2026
+ * @brief Minimal helpers shared by the test programs.
+ * @version 0.1
+ */
+
+#ifndef TVTEST_H_
+#define TVTEST_H_
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/** Number of failed checks of the running test program. */
+static int tvTestFailures = 0;
+
+/**
+ * @brief Check a condition and report it (incl. its location) if it fails.
+ */
+#define TV_CHECK(_condition) do { \
+		if (!(_condition)) { \
+			cerr << __FILE__ << ":" << __LINE__ << ": check failed: " << \
+					#_condition << '\n'; \
+			tvTestFailures++; \
+		} \
+	} while (0)
+
+/**
+ * @brief Read all lines of a file not starting with the comment indicator.
+ * @param _filePath The path of the file.
+ * @param _commentIndicator The comment indicator of the file.
+ * @return The non-empty lines which are no comments.
+ */
+static inline vector<string> ReadVectorLines(const string & _filePath,
+		const string & _commentIndicator) {
+	ifstream file(_filePath.c_str());
+	vector<string> lines;
+	string line;
+	while (getline(file, line)) {
+		if (!line.empty() && line.compare(0, _commentIndicator.length(),
+				_commentIndicator) != 0) {
+			lines.push_back(line);
+		}
+	}
+	return lines;
+}
+
+/**
+ * @brief Report the result of a test program.
+ * @return The exit code of the test program.
+ */
+static inline int TestResult() {
+	if (tvTestFailures > 0) {
+		cerr << tvTestFailures << " check(s) failed.\n";
+		return 1;
+	}
+	return 0;
+}
+
+#endif /* TVTEST_H_ */